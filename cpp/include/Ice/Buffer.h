@@ -15,6 +15,8 @@
 namespace IceInternal
 {
 
+class BufferCache;
+
 class ICE_API Buffer : private IceUtil::noncopyable
 {
 public:
@@ -139,6 +141,8 @@ public:
 
     private:
 
+        friend class BufferCache;
+
         Container(const Container&);
         void operator=(const Container&);
         void reserve(size_type);
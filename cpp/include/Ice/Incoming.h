@@ -114,6 +114,7 @@ protected:
     DispatchObserver _observer;
     bool _response;
     Ice::Byte _compress;
+    bool _priority;
     Ice::FormatType _format;
     Ice::OutputStream _os;
 
@@ -133,6 +133,11 @@ public:
         return &_is;
     }
 
+    bool isPriority() const
+    {
+        return _priority;
+    }
+
 protected:
 
     OutgoingAsyncBase(const InstancePtr&);
@@ -160,6 +165,7 @@ protected:
     Ice::ConnectionPtr _cachedConnection;
     bool _sentSynchronously;
     bool _doneInSent;
+    bool _priority;
     unsigned char _state;
 
 #ifdef ICE_CPP11_MAPPING
@@ -216,6 +222,11 @@ public:
     {
         return std::static_pointer_cast<ProxyOutgoingAsyncBase>(OutgoingAsyncBase::shared_from_this());
     }
+
+    const std::shared_ptr<Ice::ObjectPrx>& getProxy() const
+    {
+        return _proxy;
+    }
 #else
     virtual Ice::ObjectPrx getProxy() const;
     virtual Ice::CommunicatorPtr getCommunicator() const;
@@ -251,6 +262,7 @@ class ICE_API OutgoingAsync : public ProxyOutgoingAsyncBase
 public:
 
     OutgoingAsync(const Ice::ObjectPrxPtr&, bool);
+    virtual ~OutgoingAsync();
 
     void prepare(const std::string&, Ice::OperationMode, const Ice::Context&);
 
@@ -62,6 +62,13 @@ extern const ::Ice::Byte requestHdr[headerSize + sizeof(Ice::Int)];
 extern const ::Ice::Byte requestBatchHdr[headerSize + sizeof(Ice::Int)];
 extern const ::Ice::Byte replyHdr[headerSize];
 
+//
+// The context key of priority requests. These requests and their replies
+// are sent ahead of the messages without priority already queued on the
+// connection. The value of the entry is ignored.
+//
+ICE_API extern const ::std::string priorityContextKey;
+
 //
 // IPv4/IPv6 support enumeration.
 //
@@ -615,6 +615,7 @@ public:
     void _iceI_getConnection(const ::std::shared_ptr<::IceInternal::ProxyGetConnection>&);
 
     ::std::shared_ptr<::Ice::Connection> ice_getCachedConnection() const;
+    void ice_prewarmConnections();
 
     void ice_flushBatchRequests()
     {
@@ -686,6 +687,7 @@ protected:
 private:
 
     void setup(const ::IceInternal::ReferencePtr&);
+    void _shareRequestHandler(const ::std::shared_ptr<ObjectPrx>&) const;
     friend class ::IceInternal::ProxyFactory;
 
     ::IceInternal::ReferencePtr _reference;
@@ -1393,6 +1395,7 @@ public:
     ::Ice::ConnectionPtr end_ice_getConnection(const ::Ice::AsyncResultPtr&);
 
     ::Ice::ConnectionPtr ice_getCachedConnection() const;
+    void ice_prewarmConnections();
 
     void ice_flushBatchRequests()
     {
@@ -1488,6 +1491,7 @@ private:
                                                          const ::Ice::LocalObjectPtr&);
 
     void setup(const ::IceInternal::ReferencePtr&);
+    void _shareRequestHandler(const ::Ice::ObjectPrx&) const;
     friend class ::IceInternal::ProxyFactory;
 
     ::IceInternal::ReferencePtr _reference;
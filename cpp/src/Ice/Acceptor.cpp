@@ -19,3 +19,9 @@ Acceptor::~Acceptor()
 }
 
 IceUtil::Shared* IceInternal::upCast(Acceptor* p) { return p; }
+
+TransceiverPtr
+Acceptor::tryAccept()
+{
+    return 0;
+}
@@ -32,6 +32,14 @@ public:
     virtual void finishAccept() = 0;
 #endif
     virtual TransceiverPtr accept() = 0;
+
+    //
+    // Accept a connection already pending on the acceptor, without waiting
+    // for the thread pool to report the acceptor as ready again. Returns
+    // null if there's no pending connection or if the acceptor can't tell.
+    //
+    virtual TransceiverPtr tryAccept();
+
     virtual std::string protocol() const = 0;
     virtual std::string toString() const = 0;
     virtual std::string toDetailedString() const = 0;
@@ -0,0 +1,173 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/BufferCache.h>
+#include <IceUtil/ThreadException.h>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// The maximum number of buffers cached by a thread and the maximum
+// capacity of a cached buffer. Larger buffers are freed as usual.
+//
+const size_t maxCachedBuffers = 8;
+const size_t maxCachedCapacity = 16 * 1024;
+
+struct ThreadCache
+{
+    ThreadCache() : count(0)
+    {
+    }
+
+    Buffer::Container buffers[maxCachedBuffers];
+    size_t count;
+};
+
+#ifndef ICE_OS_UWP
+
+#   ifdef _WIN32
+DWORD key;
+#   else
+pthread_key_t key;
+#   endif
+
+}
+
+extern "C" void iceBufferCacheThreadDestructor(void* v)
+{
+    delete static_cast<ThreadCache*>(v);
+}
+
+namespace
+{
+
+class Init
+{
+public:
+
+    Init()
+    {
+#   ifdef _WIN32
+        key = TlsAlloc();
+        if(key == TLS_OUT_OF_INDEXES)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+        }
+#   else
+        int err = pthread_key_create(&key, &iceBufferCacheThreadDestructor);
+        if(err != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+        }
+#   endif
+    }
+
+    ~Init()
+    {
+        //
+        // The key destructor isn't called for the main thread, release
+        // the cache of the thread unloading the library here.
+        //
+#   ifdef _WIN32
+        iceBufferCacheThreadDestructor(TlsGetValue(key));
+        TlsFree(key);
+#   else
+        iceBufferCacheThreadDestructor(pthread_getspecific(key));
+        pthread_key_delete(key);
+#   endif
+    }
+};
+
+Init init;
+
+ThreadCache*
+getThreadCache(bool create)
+{
+#   ifdef _WIN32
+    ThreadCache* cache = static_cast<ThreadCache*>(TlsGetValue(key));
+#   else
+    ThreadCache* cache = static_cast<ThreadCache*>(pthread_getspecific(key));
+#   endif
+    if(!cache && create)
+    {
+        cache = new ThreadCache;
+#   ifdef _WIN32
+        if(TlsSetValue(key, cache) == 0)
+        {
+            delete cache;
+            return 0;
+        }
+#   else
+        if(pthread_setspecific(key, cache) != 0)
+        {
+            delete cache;
+            return 0;
+        }
+#   endif
+    }
+    return cache;
+}
+
+#else
+
+ThreadCache*
+getThreadCache(bool)
+{
+    return 0; // No per-thread cache with UWP.
+}
+
+#endif
+
+}
+
+void
+IceInternal::BufferCache::acquire(Buffer::Container& b)
+{
+    if(b._buf)
+    {
+        return;
+    }
+
+    ThreadCache* cache = getThreadCache(false);
+    if(cache && cache->count > 0)
+    {
+        b.swap(cache->buffers[--cache->count]);
+    }
+}
+
+void
+IceInternal::BufferCache::release(Buffer::Container& b)
+{
+    if(!b._buf || !b._owned || b._capacity > maxCachedCapacity)
+    {
+        return;
+    }
+
+    ThreadCache* cache = getThreadCache(true);
+    if(cache && cache->count < maxCachedBuffers)
+    {
+        Buffer::Container& c = cache->buffers[cache->count++];
+        c.swap(b);
+        c._size = 0;
+        c._shrinkCounter = 0;
+    }
+}
+
+#if defined(_WIN32) && !defined(ICE_OS_UWP)
+void
+IceInternal::BufferCache::cleanupThread()
+{
+    iceBufferCacheThreadDestructor(TlsGetValue(key));
+    TlsSetValue(key, 0);
+}
+#endif
@@ -0,0 +1,50 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_BUFFER_CACHE_H
+#define ICE_BUFFER_CACHE_H
+
+#include <Ice/Buffer.h>
+
+namespace IceInternal
+{
+
+//
+// A small per-thread cache of message buffer memory. Outgoing
+// invocations take their request and reply buffers from the cache of
+// the thread that creates them and give them back to the cache of the
+// thread that destroys them, so a thread issuing many small
+// invocations no longer allocates and frees a buffer for each one.
+//
+// The cache is only used if Ice.CacheMessageBuffers is enabled, it
+// holds a bounded number of buffers and never caches large buffers.
+//
+class BufferCache
+{
+public:
+
+    //
+    // Provide the given empty container with cached memory, if any.
+    //
+    static void acquire(Buffer::Container&);
+
+    //
+    // Move the memory of the given container to the cache if it's
+    // eligible for caching. The container is left untouched otherwise.
+    //
+    static void release(Buffer::Container&);
+
+#ifdef _WIN32
+    static void cleanupThread();
+#endif
+};
+
+}
+
+#endif
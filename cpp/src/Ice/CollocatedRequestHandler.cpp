@@ -204,7 +204,7 @@ CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int ba
 }
 
 void
-CollocatedRequestHandler::sendResponse(Int requestId, OutputStream* os, Byte, bool amd)
+CollocatedRequestHandler::sendResponse(Int requestId, OutputStream* os, Byte, bool, bool amd)
 {
     OutgoingAsyncBasePtr outAsync;
     {
@@ -49,7 +49,7 @@ public:
 
     virtual void asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&);
 
-    virtual void sendResponse(Ice::Int, Ice::OutputStream*, Ice::Byte, bool);
+    virtual void sendResponse(Ice::Int, Ice::OutputStream*, Ice::Byte, bool, bool);
     virtual void sendNoResponse();
     virtual bool systemException(Ice::Int, const Ice::SystemException&, bool);
     virtual void invokeException(Ice::Int, const Ice::LocalException&, int, bool);
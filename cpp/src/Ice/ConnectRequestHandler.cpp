@@ -11,6 +11,8 @@
 #include <Ice/ConnectionRequestHandler.h>
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/Instance.h>
+#include <Ice/DefaultsAndOverrides.h>
+#include <Ice/EndpointI.h>
 #include <Ice/Proxy.h>
 #include <Ice/ConnectionI.h>
 #include <Ice/RouterInfo.h>
@@ -322,7 +324,15 @@ ConnectRequestHandler::flushRequests()
     //
     if(_reference->getCacheConnection() && !exception)
     {
-        _requestHandler = ICE_MAKE_SHARED(ConnectionRequestHandler, _reference, _connection, _compress);
+        //
+        // With a connection pool, the connection request handler spreads
+        // the invocations over the pooled connections of the endpoint.
+        // Routed connections aren't pooled, callbacks from the router are
+        // only received over the connection with the router adapter.
+        //
+        bool pooled = _reference->getInstance()->defaultsAndOverrides()->defaultConnectionPoolSize > 1 &&
+                      !_reference->getRouterInfo() && !_connection->endpoint()->datagram();
+        _requestHandler = ICE_MAKE_SHARED(ConnectionRequestHandler, _reference, _connection, _compress, pooled);
         for(set<Ice::ObjectPrxPtr>::const_iterator p = _proxies.begin(); p != _proxies.end(); ++p)
         {
             (*p)->_updateRequestHandler(ICE_SHARED_FROM_THIS, _requestHandler);
@@ -53,6 +53,12 @@ IceUtil::Shared* IceInternal::upCast(IncomingConnectionFactory* p) { return p; }
 namespace
 {
 
+//
+// The maximum number of connections accepted for a single readiness
+// event of an acceptor.
+//
+const int acceptBatchSize = 32;
+
 struct RandomNumberGenerator : public std::unary_function<ptrdiff_t, ptrdiff_t>
 {
     ptrdiff_t operator()(ptrdiff_t d)
@@ -146,6 +152,58 @@ private:
     IncomingConnectionFactoryPtr _factory;
 };
 
+//
+// Callback for the connections established in the background to grow
+// a connection pool, failures are traced by the factory and delay the
+// next attempt to grow the pool.
+//
+class GrowConnectionPoolCallback : public OutgoingConnectionFactory::CreateConnectionCallback
+{
+public:
+
+    GrowConnectionPoolCallback(const OutgoingConnectionFactoryPtr& factory, const ConnectorPtr& connector) :
+        _factory(factory), _connector(connector)
+    {
+    }
+
+    virtual void
+    setConnection(const ConnectionIPtr&, bool)
+    {
+    }
+
+    virtual void
+    setException(const LocalException&)
+    {
+        _factory->growConnectionPoolFailed(_connector);
+    }
+
+private:
+
+    const OutgoingConnectionFactoryPtr _factory;
+    const ConnectorPtr _connector;
+};
+
+class GrowConnectionPoolRetry : public IceUtil::TimerTask
+{
+public:
+
+    GrowConnectionPoolRetry(const OutgoingConnectionFactoryPtr& factory, const ConnectorPtr& connector) :
+        _factory(factory), _connector(connector)
+    {
+    }
+
+    void
+    runTimerTask()
+    {
+        _factory->growConnectionPoolRetry(_connector);
+    }
+
+private:
+
+    const OutgoingConnectionFactoryPtr _factory;
+    const ConnectorPtr _connector;
+};
+
 }
 
 bool
@@ -168,6 +226,7 @@ IceInternal::OutgoingConnectionFactory::destroy()
              bind2nd(Ice::secondVoidMemFun1<const ConnectorPtr, ConnectionI, ConnectionI::DestructionReason>
                      (&ConnectionI::destroy), ConnectionI::CommunicatorDestroyed));
 
+    _connectionsByEndpoint.destroy();
     _destroyed = true;
     _communicator = 0;
 
@@ -268,6 +327,65 @@ IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpt
     cb->getConnectors();
 }
 
+int
+IceInternal::OutgoingConnectionFactory::getConnectionPool(const ConnectionIPtr& connection,
+                                                          vector<ConnectionIPtr>& pool)
+{
+    //
+    // Return the active connections of the pool the given connection
+    // belongs to and grow the pool if it's not full. The returned
+    // generation is read first: the pool is stale once the generation
+    // changes.
+    //
+    int generation = _poolGeneration.load();
+    _connectionsByEndpoint.findAll(connection->endpoint(), pool);
+    if(!pool.empty() && pool.size() < static_cast<size_t>(_instance->defaultsAndOverrides()->defaultConnectionPoolSize))
+    {
+        growConnectionPool(pool.front());
+    }
+    return generation;
+}
+
+int
+IceInternal::OutgoingConnectionFactory::getConnectionPoolGeneration() const
+{
+    return _poolGeneration.load();
+}
+
+void
+IceInternal::OutgoingConnectionFactory::growConnectionPoolFailed(const ConnectorPtr& connector)
+{
+    //
+    // Don't try again to grow the pool of this connector before the retry
+    // interval elapsed. Once it elapsed, the pool generation changes and
+    // the request handlers of the pool grow it again.
+    //
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    if(_destroyed)
+    {
+        return;
+    }
+
+    _growConnectionPoolRetries.insert(connector);
+    try
+    {
+        _instance->timer()->schedule(ICE_MAKE_SHARED(GrowConnectionPoolRetry, this, connector),
+                                     IceUtil::Time::seconds(1));
+    }
+    catch(const Ice::CommunicatorDestroyedException&)
+    {
+        // Ignore.
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::growConnectionPoolRetry(const ConnectorPtr& connector)
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    _growConnectionPoolRetries.erase(connector);
+    _poolGeneration.fetch_add(1);
+}
+
 void
 IceInternal::OutgoingConnectionFactory::setRouterInfo(const RouterInfoPtr& routerInfo)
 {
@@ -378,7 +496,8 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
     _destroyed(false),
-    _pendingConnectCount(0)
+    _pendingConnectCount(0),
+    _poolGeneration(0)
 {
 }
 
@@ -412,19 +531,24 @@ IceInternal::OutgoingConnectionFactory::applyOverrides(const vector<EndpointIPtr
 ConnectionIPtr
 IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr>& endpoints, bool& compress)
 {
-    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
-    if(_destroyed)
-    {
-        throw CommunicatorDestroyedException(__FILE__, __LINE__);
-    }
-
+    //
+    // The factory mutex isn't locked here, the endpoint table takes care
+    // of the synchronization and raises CommunicatorDestroyedException
+    // if the factory is destroyed.
+    //
     DefaultsAndOverridesPtr defaultsAndOverrides = _instance->defaultsAndOverrides();
     assert(!endpoints.empty());
     for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
     {
-        ConnectionIPtr connection = find(_connectionsByEndpoint, *p, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
+        size_t count;
+        ConnectionIPtr connection = _connectionsByEndpoint.find(*p, count);
         if(connection)
         {
+            if(count < static_cast<size_t>(defaultsAndOverrides->defaultConnectionPoolSize))
+            {
+                growConnectionPool(connection);
+            }
+
             if(defaultsAndOverrides->overrideCompress)
             {
                 compress = defaultsAndOverrides->overrideCompressValue;
@@ -445,14 +569,39 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInf
     // This must be called with the mutex locked.
 
     DefaultsAndOverridesPtr defaultsAndOverrides = _instance->defaultsAndOverrides();
+    const bool pooled = defaultsAndOverrides->defaultConnectionPoolSize > 1;
     for(vector<ConnectorInfo>::const_iterator p = connectors.begin(); p != connectors.end(); ++p)
     {
-        if(_pending.find(p->connector) != _pending.end())
+        ConnectionIPtr connection;
+        if(!pooled)
         {
-            continue;
+            if(_pending.find(p->connector) != _pending.end())
+            {
+                continue;
+            }
+            connection = find(_connections, p->connector, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
+        }
+        else
+        {
+            //
+            // A pending connection to a connector with active connections
+            // grows its pool, don't wait for it and pick the least loaded
+            // active connection instead.
+            //
+            int load = 0;
+            pair<multimap<ConnectorPtr, ConnectionIPtr>::const_iterator,
+                 multimap<ConnectorPtr, ConnectionIPtr>::const_iterator> pr = _connections.equal_range(p->connector);
+            for(multimap<ConnectorPtr, ConnectionIPtr>::const_iterator q = pr.first; q != pr.second; ++q)
+            {
+                int l = q->second->getLoad();
+                if(l >= 0 && (!connection || l < load))
+                {
+                    connection = q->second;
+                    load = l;
+                }
+            }
         }
 
-        ConnectionIPtr connection = find(_connections, p->connector, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
         if(connection)
         {
             if(defaultsAndOverrides->overrideCompress)
@@ -521,8 +670,8 @@ IceInternal::OutgoingConnectionFactory::getConnection(const vector<ConnectorInfo
         for(vector<Ice::ConnectionIPtr>::const_iterator p = cons.begin(); p != cons.end(); ++p)
         {
             remove(_connections, (*p)->connector(), *p);
-            remove(_connectionsByEndpoint, (*p)->endpoint(), *p);
-            remove(_connectionsByEndpoint, (*p)->endpoint()->compress(true), *p);
+            _connectionsByEndpoint.remove((*p)->endpoint(), *p);
+            _connectionsByEndpoint.remove((*p)->endpoint()->compress(true), *p);
         }
 
         //
@@ -629,12 +778,59 @@ IceInternal::OutgoingConnectionFactory::createConnection(const TransceiverPtr& t
     }
 
     _connections.insert(pair<const ConnectorPtr, ConnectionIPtr>(ci.connector, connection));
-    _connectionsByEndpoint.insert(pair<const EndpointIPtr, ConnectionIPtr>(connection->endpoint(), connection));
-    _connectionsByEndpoint.insert(pair<const EndpointIPtr, ConnectionIPtr>(connection->endpoint()->compress(true),
-                                                                           connection));
+    _connectionsByEndpoint.add(connection->endpoint(), connection);
+    _connectionsByEndpoint.add(connection->endpoint()->compress(true), connection);
     return connection;
 }
 
+void
+IceInternal::OutgoingConnectionFactory::growConnectionPool(const ConnectionIPtr& connection)
+{
+    ConnectorInfo ci(connection->connector(), connection->endpoint());
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        if(_destroyed || _pending.find(ci.connector) != _pending.end() ||
+           _growConnectionPoolRetries.find(ci.connector) != _growConnectionPoolRetries.end())
+        {
+            return; // Destroyed, already connecting to this connector or waiting to retry after a failure.
+        }
+
+        size_t count = 0;
+        pair<multimap<ConnectorPtr, ConnectionIPtr>::const_iterator,
+             multimap<ConnectorPtr, ConnectionIPtr>::const_iterator> pr = _connections.equal_range(ci.connector);
+        for(multimap<ConnectorPtr, ConnectionIPtr>::const_iterator q = pr.first; q != pr.second; ++q)
+        {
+            if(q->second->isActiveOrHolding())
+            {
+                ++count;
+            }
+        }
+        if(count >= static_cast<size_t>(_instance->defaultsAndOverrides()->defaultConnectionPoolSize))
+        {
+            return;
+        }
+
+        //
+        // Register the pending connection, the pending connect count is
+        // decremented once the connection establishment completes.
+        //
+        _pending.insert(pair<ConnectorPtr, set<ConnectCallbackPtr> >(ci.connector, set<ConnectCallbackPtr>()));
+        ++_pendingConnectCount;
+    }
+
+    vector<EndpointIPtr> endpoints;
+    endpoints.push_back(ci.endpoint);
+    CreateConnectionCallbackPtr callback = new GrowConnectionPoolCallback(this, ci.connector);
+#ifdef ICE_CPP11_MAPPING
+    auto cb = make_shared<ConnectCallback>(_instance, this, endpoints, false, callback,
+                                           ICE_ENUM(EndpointSelectionType, Ordered));
+#else
+    ConnectCallbackPtr cb = new ConnectCallback(_instance, this, endpoints, false, callback,
+                                                ICE_ENUM(EndpointSelectionType, Ordered));
+#endif
+    cb->connect(ci);
+}
+
 void
 IceInternal::OutgoingConnectionFactory::finishGetConnection(const vector<ConnectorInfo>& connectors,
                                                             const ConnectorInfo& ci,
@@ -680,6 +876,15 @@ IceInternal::OutgoingConnectionFactory::finishGetConnection(const vector<Connect
             (*r)->removeFromPending();
         }
         notifyAll();
+
+        //
+        // The request handlers refresh their connection pool with the new
+        // connection.
+        //
+        if(_instance->defaultsAndOverrides()->defaultConnectionPoolSize > 1)
+        {
+            _poolGeneration.fetch_add(1);
+        }
     }
 
     bool compress;
@@ -1074,6 +1279,18 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
     }
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connect(const ConnectorInfo& ci)
+{
+    //
+    // Called by the factory to establish an additional connection to a
+    // connector which is already registered as pending.
+    //
+    _connectors.push_back(ci);
+    _iter = _connectors.begin();
+    nextConnector();
+}
+
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::setConnection(const Ice::ConnectionIPtr& connection,
                                                                        bool compress)
@@ -1154,6 +1371,133 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
     return false;
 }
 
+ConnectionIPtr
+IceInternal::OutgoingConnectionFactory::EndpointTable::find(const EndpointIPtr& endpoint, size_t& count) const
+{
+    Ice::Int h = endpoint->hash();
+    Shard& s = _shards.get(h);
+
+    IceUtil::Mutex::Lock sync(s.mutex);
+    if(s.destroyed)
+    {
+        throw CommunicatorDestroyedException(__FILE__, __LINE__);
+    }
+
+    //
+    // Return the active connection with the least outstanding requests
+    // and the number of active connections for the endpoint.
+    //
+    count = 0;
+    ConnectionIPtr connection;
+    int load = 0;
+    pair<EntryMap::const_iterator, EntryMap::const_iterator> pr = s.entries.equal_range(h);
+    for(EntryMap::const_iterator q = pr.first; q != pr.second; ++q)
+    {
+        if(*q->second.first == *endpoint)
+        {
+            int l = q->second.second->getLoad();
+            if(l >= 0)
+            {
+                ++count;
+                if(!connection || l < load)
+                {
+                    connection = q->second.second;
+                    load = l;
+                }
+            }
+        }
+    }
+    return connection;
+}
+
+void
+IceInternal::OutgoingConnectionFactory::EndpointTable::findAll(const EndpointIPtr& endpoint,
+                                                               vector<ConnectionIPtr>& connections) const
+{
+    Ice::Int h = endpoint->hash();
+    Shard& s = _shards.get(h);
+
+    IceUtil::Mutex::Lock sync(s.mutex);
+    if(s.destroyed)
+    {
+        throw CommunicatorDestroyedException(__FILE__, __LINE__);
+    }
+
+    pair<EntryMap::const_iterator, EntryMap::const_iterator> pr = s.entries.equal_range(h);
+    for(EntryMap::const_iterator q = pr.first; q != pr.second; ++q)
+    {
+        if(*q->second.first == *endpoint && q->second.second->getLoad() >= 0)
+        {
+            connections.push_back(q->second.second);
+        }
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::EndpointTable::add(const EndpointIPtr& endpoint,
+                                                           const ConnectionIPtr& connection)
+{
+    Ice::Int h = endpoint->hash();
+    Shard& s = _shards.get(h);
+
+    IceUtil::Mutex::Lock sync(s.mutex);
+    s.entries.insert(EntryMap::value_type(h, make_pair(endpoint, connection)));
+}
+
+void
+IceInternal::OutgoingConnectionFactory::EndpointTable::remove(const EndpointIPtr& endpoint,
+                                                              const ConnectionIPtr& connection)
+{
+    Ice::Int h = endpoint->hash();
+    Shard& s = _shards.get(h);
+
+    IceUtil::Mutex::Lock sync(s.mutex);
+    pair<EntryMap::iterator, EntryMap::iterator> pr = s.entries.equal_range(h);
+    for(EntryMap::iterator q = pr.first; q != pr.second; ++q)
+    {
+        if(q->second.second == connection && *q->second.first == *endpoint)
+        {
+            s.entries.erase(q);
+            return;
+        }
+    }
+    assert(false); // Nothing was removed which is an error.
+}
+
+void
+IceInternal::OutgoingConnectionFactory::EndpointTable::destroy()
+{
+    for(size_t i = 0; i < _shards.size(); ++i)
+    {
+        IceUtil::Mutex::Lock sync(_shards[i].mutex);
+        _shards[i].destroyed = true;
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::EndpointTable::clear()
+{
+    for(size_t i = 0; i < _shards.size(); ++i)
+    {
+        IceUtil::Mutex::Lock sync(_shards[i].mutex);
+        _shards[i].entries.clear();
+    }
+}
+
+bool
+IceInternal::OutgoingConnectionFactory::EndpointTable::empty() const
+{
+    for(size_t i = 0; i < _shards.size(); ++i)
+    {
+        IceUtil::Mutex::Lock sync(_shards[i].mutex);
+        if(!_shards[i].entries.empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void
 IceInternal::IncomingConnectionFactory::activate()
 {
@@ -1374,7 +1718,7 @@ IceInternal::IncomingConnectionFactory::finishAsync(SocketOperation)
 void
 IceInternal::IncomingConnectionFactory::message(ThreadPoolCurrent& current)
 {
-    ConnectionIPtr connection;
+    vector<ConnectionIPtr> connections;
 
     ThreadPoolMessage<IncomingConnectionFactory> msg(current, *this);
 
@@ -1413,78 +1757,89 @@ IceInternal::IncomingConnectionFactory::message(ThreadPoolCurrent& current)
         }
 
         //
-        // Now accept a new connection.
+        // Now accept new connections. If the acceptor supports it, the
+        // connections already pending in the backlog are accepted in the
+        // same batch instead of waiting for the thread pool to report the
+        // acceptor as ready again for each of them.
         //
-        TransceiverPtr transceiver;
-        try
+        while(connections.size() < static_cast<size_t>(acceptBatchSize))
         {
-            transceiver = _acceptor->accept();
-
-            if(_instance->traceLevels()->network >= 2)
-            {
-                Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "trying to accept " << _endpoint->protocol() << " connection\n" << transceiver->toString();
-            }
-        }
-        catch(const SocketException& ex)
-        {
-            if(noMoreFds(ex.error))
+            TransceiverPtr transceiver;
+            try
             {
-                Error out(_instance->initializationData().logger);
-                out << "can't accept more connections:\n" << ex << '\n' << _acceptor->toString();
+                transceiver = connections.empty() ? _acceptor->accept() : _acceptor->tryAccept();
+                if(!transceiver)
+                {
+                    break;
+                }
 
-                if(_adapter->getThreadPool()->finish(ICE_SHARED_FROM_THIS, true))
+                if(_instance->traceLevels()->network >= 2)
                 {
-                    closeAcceptor();
+                    Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+                    out << "trying to accept " << _endpoint->protocol() << " connection\n" << transceiver->toString();
                 }
             }
+            catch(const SocketException& ex)
+            {
+                if(noMoreFds(ex.error))
+                {
+                    Error out(_instance->initializationData().logger);
+                    out << "can't accept more connections:\n" << ex << '\n' << _acceptor->toString();
 
-            // Ignore socket exceptions.
-            return;
-        }
-        catch(const LocalException& ex)
-        {
-            // Warn about other Ice local exceptions.
-            if(_warn)
+                    if(_adapter->getThreadPool()->finish(ICE_SHARED_FROM_THIS, true))
+                    {
+                        closeAcceptor();
+                    }
+                }
+
+                // Ignore socket exceptions.
+                break;
+            }
+            catch(const LocalException& ex)
             {
-                Warning out(_instance->initializationData().logger);
-                out << "connection exception:\n" << ex << '\n' << _acceptor->toString();
+                // Warn about other Ice local exceptions.
+                if(_warn)
+                {
+                    Warning out(_instance->initializationData().logger);
+                    out << "connection exception:\n" << ex << '\n' << _acceptor->toString();
+                }
+                break;
             }
-            return;
-        }
 
-        assert(transceiver);
+            assert(transceiver);
 
-        try
-        {
-            connection = ConnectionI::create(_adapter->getCommunicator(), _instance, _monitor, transceiver, 0,
-                                             _endpoint, _adapter);
-        }
-        catch(const LocalException& ex)
-        {
             try
             {
-                transceiver->close();
+                ConnectionIPtr connection = ConnectionI::create(_adapter->getCommunicator(), _instance, _monitor,
+                                                                transceiver, 0, _endpoint, _adapter);
+                _connections.insert(connection);
+                connections.push_back(connection);
             }
-            catch(const Ice::LocalException&)
+            catch(const LocalException& ex)
             {
-                // Ignore.
-            }
+                try
+                {
+                    transceiver->close();
+                }
+                catch(const Ice::LocalException&)
+                {
+                    // Ignore.
+                }
 
-            if(_warn)
-            {
-                Warning out(_instance->initializationData().logger);
-                out << "connection exception:\n" << ex << '\n' << _acceptor->toString();
+                if(_warn)
+                {
+                    Warning out(_instance->initializationData().logger);
+                    out << "connection exception:\n" << ex << '\n' << _acceptor->toString();
+                }
+                break;
             }
-            return;
         }
-
-        _connections.insert(connection);
     }
 
-    assert(connection);
-
-    connection->start(ICE_SHARED_FROM_THIS);
+    for(vector<ConnectionIPtr>::const_iterator p = connections.begin(); p != connections.end(); ++p)
+    {
+        (*p)->start(ICE_SHARED_FROM_THIS);
+    }
 }
 
 void
@@ -12,6 +12,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Atomic.h>
 #include <Ice/CommunicatorF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ConnectionI.h>
@@ -28,6 +29,7 @@
 #include <Ice/InstrumentationF.h>
 #include <Ice/ACMF.h>
 #include <Ice/Comparable.h>
+#include <Ice/Shards.h>
 
 #include <list>
 #include <set>
@@ -64,6 +66,16 @@ public:
     void waitUntilFinished();
 
     void create(const std::vector<EndpointIPtr>&, bool, Ice::EndpointSelectionType, const CreateConnectionCallbackPtr&);
+
+    //
+    // The connection pools, used by the connection request handlers to
+    // spread the invocations over the connections of a pool.
+    //
+    int getConnectionPool(const Ice::ConnectionIPtr&, std::vector<Ice::ConnectionIPtr>&);
+    int getConnectionPoolGeneration() const;
+    void growConnectionPoolFailed(const ConnectorPtr&);
+    void growConnectionPoolRetry(const ConnectorPtr&);
+
     void setRouterInfo(const RouterInfoPtr&);
     void removeAdapter(const Ice::ObjectAdapterPtr&);
     void flushAsyncBatchRequests(const CommunicatorFlushBatchAsyncPtr&, Ice::CompressBatch);
@@ -109,6 +121,7 @@ private:
 
         void getConnection();
         void nextConnector();
+        void connect(const ConnectorInfo&);
 
         void setConnection(const Ice::ConnectionIPtr&, bool);
         void setException(const Ice::LocalException&);
@@ -137,6 +150,41 @@ private:
     ICE_DEFINE_PTR(ConnectCallbackPtr, ConnectCallback);
     friend class ConnectCallback;
 
+    //
+    // Established connections indexed by endpoint. Proxies look up their
+    // connection here without locking the factory, whose mutex is held
+    // while connections are being established.
+    //
+    class EndpointTable : public IceUtil::noncopyable
+    {
+    public:
+
+        Ice::ConnectionIPtr find(const EndpointIPtr&, size_t&) const;
+        void findAll(const EndpointIPtr&, std::vector<Ice::ConnectionIPtr>&) const;
+        void add(const EndpointIPtr&, const Ice::ConnectionIPtr&);
+        void remove(const EndpointIPtr&, const Ice::ConnectionIPtr&);
+        void destroy();
+        void clear();
+        bool empty() const;
+
+    private:
+
+        typedef std::multimap<Ice::Int, std::pair<EndpointIPtr, Ice::ConnectionIPtr> > EntryMap;
+
+        struct Shard
+        {
+            Shard() : destroyed(false)
+            {
+            }
+
+            IceUtil::Mutex mutex;
+            bool destroyed;
+            EntryMap entries; // Keyed by endpoint hash.
+        };
+
+        Shards<Shard> _shards;
+    };
+
     std::vector<EndpointIPtr> applyOverrides(const std::vector<EndpointIPtr>&);
     Ice::ConnectionIPtr findConnection(const std::vector<EndpointIPtr>&, bool&);
     void incPendingConnectCount();
@@ -151,6 +199,7 @@ private:
 
     Ice::ConnectionIPtr findConnection(const std::vector<ConnectorInfo>&, bool&);
     Ice::ConnectionIPtr createConnection(const TransceiverPtr&, const ConnectorInfo&);
+    void growConnectionPool(const Ice::ConnectionIPtr&);
 
     void handleException(const Ice::LocalException&, bool);
     void handleConnectionException(const Ice::LocalException&, bool);
@@ -162,13 +211,11 @@ private:
 
     std::multimap<ConnectorPtr, Ice::ConnectionIPtr> _connections;
     std::map<ConnectorPtr, std::set<ConnectCallbackPtr> > _pending;
-
-#ifdef ICE_CPP11_MAPPING
-    std::multimap<EndpointIPtr, Ice::ConnectionIPtr, Ice::TargetCompare<EndpointIPtr, std::less>> _connectionsByEndpoint;
-#else
-    std::multimap<EndpointIPtr, Ice::ConnectionIPtr> _connectionsByEndpoint;
-#endif
+    EndpointTable _connectionsByEndpoint;
     int _pendingConnectCount;
+
+    std::set<ConnectorPtr> _growConnectionPoolRetries;
+    IceUtilInternal::Atomic _poolGeneration;
 };
 
 class IncomingConnectionFactory : public EventHandler,
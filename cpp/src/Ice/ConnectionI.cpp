@@ -558,6 +558,17 @@ Ice::ConnectionI::isFinished() const
     return true;
 }
 
+int
+Ice::ConnectionI::getLoad() const
+{
+    //
+    // The mutex isn't locked, the load is updated when the state, the
+    // requests waiting for a reply or the messages queued for sending
+    // change.
+    //
+    return _load.load();
+}
+
 void
 Ice::ConnectionI::throwException() const
 {
@@ -772,6 +783,7 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
         //
         _asyncRequestsHint = _asyncRequests.insert(_asyncRequests.end(),
                                                    pair<const Int, OutgoingAsyncBasePtr>(requestId, out));
+        updateLoad();
     }
     return status;
 }
@@ -910,6 +922,7 @@ public:
         _communicator(communicator),
         _connection(connection)
     {
+        _priority = true;
     }
 
     virtual CommunicatorPtr getCommunicator() const
@@ -1234,6 +1247,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
                     o->canceled(false);
                     _sendStreams.erase(o);
                 }
+                updateLoad();
                 if(outAsync->exception(ex))
                 {
                     outAsync->invokeExceptionAsync();
@@ -1243,6 +1257,24 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         }
     }
 
+    for(deque<OutgoingMessage>::iterator o = _queuedStreams.begin(); o != _queuedStreams.end(); ++o)
+    {
+        if(o->outAsync.get() == outAsync.get())
+        {
+            //
+            // The transceiver has a copy of the message, it's still sent.
+            //
+            o->canceled(false);
+            _queuedStreams.erase(o);
+            updateLoad();
+            if(outAsync->exception(ex))
+            {
+                outAsync->invokeExceptionAsync();
+            }
+            return;
+        }
+    }
+
     if(ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
     {
         if(_asyncRequestsHint != _asyncRequests.end())
@@ -1257,6 +1289,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
                 {
                     _asyncRequests.erase(_asyncRequestsHint);
                     _asyncRequestsHint = _asyncRequests.end();
+                    updateLoad();
                     if(outAsync->exception(ex))
                     {
                         outAsync->invokeExceptionAsync();
@@ -1278,6 +1311,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
                 {
                     assert(p != _asyncRequestsHint);
                     _asyncRequests.erase(p);
+                    updateLoad();
                     if(outAsync->exception(ex))
                     {
                         outAsync->invokeExceptionAsync();
@@ -1290,7 +1324,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
 }
 
 void
-Ice::ConnectionI::sendResponse(Int, OutputStream* os, Byte compressFlag, bool /*amd*/)
+Ice::ConnectionI::sendResponse(Int, OutputStream* os, Byte compressFlag, bool priority, bool /*amd*/)
 {
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     assert(_state > StateNotValidated);
@@ -1312,7 +1346,7 @@ Ice::ConnectionI::sendResponse(Int, OutputStream* os, Byte compressFlag, bool /*
             _exception->ice_throw();
         }
 
-        OutgoingMessage message(os, compressFlag > 0);
+        OutgoingMessage message(os, compressFlag > 0, priority);
         sendMessage(message);
 
         if(_state == StateClosing && _dispatchCount == 0)
@@ -2096,6 +2130,16 @@ Ice::ConnectionI::finish(bool close)
         _sendStreams.clear();
     }
 
+    for(deque<OutgoingMessage>::iterator o = _queuedStreams.begin(); o != _queuedStreams.end(); ++o)
+    {
+        o->completed(*_exception);
+        if(o->requestId)
+        {
+            _asyncRequests.erase(o->requestId);
+        }
+    }
+    _queuedStreams.clear();
+
     for(map<Int, OutgoingAsyncBasePtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
     {
         if(q->second->exception(*_exception))
@@ -2247,7 +2291,8 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _state(StateNotInitialized),
     _shutdownInitiated(false),
     _initialized(false),
-    _validated(false)
+    _validated(false),
+    _load(-1)
 {
     const Ice::PropertiesPtr& properties = _instance->initializationData().properties;
 
@@ -2304,6 +2349,7 @@ Ice::ConnectionI::~ConnectionI()
     assert(_state == StateFinished);
     assert(_dispatchCount == 0);
     assert(_sendStreams.empty());
+    assert(_queuedStreams.empty());
     assert(_asyncRequests.empty());
 }
 
@@ -2527,6 +2573,7 @@ Ice::ConnectionI::setState(State state)
         }
     }
     _state = state;
+    updateLoad();
 
     notifyAll();
 
@@ -2570,7 +2617,7 @@ Ice::ConnectionI::initiateShutdown()
         os.write(static_cast<Byte>(1)); // compression status: compression supported but not used.
         os.write(headerSize); // Message size.
 
-        OutgoingMessage message(&os, false);
+        OutgoingMessage message(&os, false, false);
         if(sendMessage(message) & AsyncStatusSent)
         {
             setState(StateClosingPending);
@@ -2608,7 +2655,12 @@ Ice::ConnectionI::sendHeartbeatNow()
         os.i = os.b.begin();
         try
         {
-            OutgoingMessage message(&os, false);
+            //
+            // Heartbeats overtake the queued messages, the peer might
+            // otherwise close the connection while a large message is
+            // still being sent.
+            //
+            OutgoingMessage message(&os, false, true);
             sendMessage(message);
         }
         catch(const LocalException& ex)
@@ -2791,21 +2843,44 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
     assert(!_writeStream.b.empty() && _writeStream.i == _writeStream.b.end());
     try
     {
+        bool queued = false;
         while(true)
         {
             //
-            // Notify the message that it was sent.
+            // Notify the message that it was sent. If it was only queued by
+            // the transceiver, it's notified once the next message is sent.
             //
             OutgoingMessage* message = &_sendStreams.front();
+            if(!queued)
+            {
+                for(deque<OutgoingMessage>::iterator q = _queuedStreams.begin(); q != _queuedStreams.end(); ++q)
+                {
+                    if(_observer)
+                    {
+                        _observer->sentBytes(static_cast<Int>(q->stream->b.size()));
+                    }
+                    if(q->sent())
+                    {
+                        callbacks.push_back(*q);
+                    }
+                }
+                _queuedStreams.clear();
+            }
             if(message->stream)
             {
                 _writeStream.swap(*message->stream);
-                if(message->sent())
+                if(queued)
+                {
+                    _queuedStreams.push_back(*message);
+                }
+                else if(message->sent())
                 {
                     callbacks.push_back(*message);
                 }
             }
             _sendStreams.pop_front();
+            updateLoad();
+            queued = false;
 
             //
             // If there's nothing left to send, we're done.
@@ -2880,6 +2955,18 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
 #endif
             _writeStream.swap(*message->stream);
 
+            //
+            // If other messages are waiting, the transceiver might keep this
+            // one to send it with the next one.
+            //
+            assert(_writeStream.i);
+            if(_writeStream.i != _writeStream.b.end() && _sendStreams.size() > 1 &&
+               _transceiver->queue(_writeStream))
+            {
+                queued = true;
+                continue;
+            }
+
             //
             // Send the message.
             //
@@ -2887,7 +2974,6 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             {
                 _observer.startWrite(_writeStream);
             }
-            assert(_writeStream.i);
             if(_writeStream.i != _writeStream.b.end())
             {
                 SocketOperation op = write(_writeStream);
@@ -2932,8 +3018,23 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
     if(!_sendStreams.empty())
     {
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(0);
+        //
+        // A priority message is queued after the other priority messages
+        // but ahead of the messages without priority. The first message
+        // of the queue is never overtaken, it might be partially sent.
+        //
+        deque<OutgoingMessage>::iterator p = _sendStreams.end();
+        if(message.priority)
+        {
+            p = _sendStreams.begin() + 1;
+            while(p != _sendStreams.end() && p->priority)
+            {
+                ++p;
+            }
+        }
+        p = _sendStreams.insert(p, message);
+        p->adopt(0);
+        updateLoad();
         return AsyncStatusQueued;
     }
 
@@ -2990,6 +3091,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
         _sendStreams.push_back(message);
         _sendStreams.back().adopt(&stream);
+        updateLoad();
     }
     else
     {
@@ -3044,6 +3146,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
         _sendStreams.push_back(message);
         _sendStreams.back().adopt(0); // Adopt the stream.
+        updateLoad();
 #ifdef ICE_HAS_BZIP2
     }
 #endif
@@ -3356,6 +3459,7 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
                     {
                         _asyncRequests.erase(q);
                     }
+                    updateLoad();
 
                     stream.swap(*outAsync->getIs());
 
@@ -3469,6 +3573,23 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
     }
 }
 
+void
+Ice::ConnectionI::updateLoad()
+{
+    //
+    // Must be called with the mutex locked. The load is only meaningful
+    // for active or holding connections, -1 otherwise.
+    //
+    if(_state > StateNotValidated && _state < StateClosing)
+    {
+        _load.exchange(static_cast<int>(_asyncRequests.size() + _sendStreams.size() + _queuedStreams.size()));
+    }
+    else
+    {
+        _load.exchange(-1);
+    }
+}
+
 void
 Ice::ConnectionI::scheduleTimeout(SocketOperation status)
 {
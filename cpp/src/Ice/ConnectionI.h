@@ -15,6 +15,7 @@
 #include <IceUtil/Time.h>
 #include <IceUtil/StopWatch.h>
 #include <IceUtil/Timer.h>
+#include <IceUtil/Atomic.h>
 #include <Ice/UniquePtr.h>
 
 #include <Ice/CommunicatorF.h>
@@ -92,8 +93,8 @@ public:
 
     struct OutgoingMessage
     {
-        OutgoingMessage(Ice::OutputStream* str, bool comp) :
-            stream(str), compress(comp), requestId(0), adopted(false)
+        OutgoingMessage(Ice::OutputStream* str, bool comp, bool prio) :
+            stream(str), compress(comp), priority(prio), requestId(0), adopted(false)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -102,7 +103,7 @@ public:
 
         OutgoingMessage(const IceInternal::OutgoingAsyncBasePtr& o, Ice::OutputStream* str,
                         bool comp, int rid) :
-            stream(str), outAsync(o), compress(comp), requestId(rid), adopted(false)
+            stream(str), outAsync(o), compress(comp), priority(o->isPriority()), requestId(rid), adopted(false)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -117,6 +118,7 @@ public:
         Ice::OutputStream* stream;
         IceInternal::OutgoingAsyncBasePtr outAsync;
         bool compress;
+        bool priority;
         int requestId;
         bool adopted;
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
@@ -161,6 +163,15 @@ public:
     bool isActiveOrHolding() const;
     bool isFinished() const;
 
+    //
+    // The number of requests waiting for a reply and of messages queued
+    // for sending, or -1 if the connection isn't active or holding. This
+    // doesn't lock the connection, it's used by the outgoing connection
+    // factory and the request handlers to pick the least loaded
+    // connection of a connection pool.
+    //
+    int getLoad() const;
+
     virtual void throwException() const; // From Connection. Throws the connection exception if destroyed.
 
     void waitUntilHolding() const;
@@ -213,7 +224,7 @@ public:
 
     virtual void asyncRequestCanceled(const IceInternal::OutgoingAsyncBasePtr&, const LocalException&);
 
-    virtual void sendResponse(Int, Ice::OutputStream*, Byte, bool);
+    virtual void sendResponse(Int, Ice::OutputStream*, Byte, bool, bool);
     virtual void sendNoResponse();
     virtual bool systemException(Int, const SystemException&, bool);
     virtual void invokeException(Ice::Int, const LocalException&, int, bool);
@@ -308,6 +319,8 @@ private:
     void invokeAll(Ice::InputStream&, Int, Int, Byte,
                    const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&);
 
+    void updateLoad();
+
     void scheduleTimeout(IceInternal::SocketOperation status);
     void unscheduleTimeout(IceInternal::SocketOperation status);
 
@@ -372,6 +385,12 @@ private:
 
     std::deque<OutgoingMessage> _sendStreams;
 
+    //
+    // The messages queued by the transceiver to be sent with the next
+    // message. They are notified once the write of this message succeeds.
+    //
+    std::deque<OutgoingMessage> _queuedStreams;
+
     Ice::InputStream _readStream;
     bool _readHeader;
     Ice::OutputStream _writeStream;
@@ -385,6 +404,8 @@ private:
     bool _initialized;
     bool _validated;
 
+    IceUtilInternal::Atomic _load;
+
     ICE_DELEGATE(CloseCallback) _closeCallback;
     ICE_DELEGATE(HeartbeatCallback) _heartbeatCallback;
 };
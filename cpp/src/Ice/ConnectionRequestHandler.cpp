@@ -13,17 +13,33 @@
 #include <Ice/ConnectionI.h>
 #include <Ice/RouterInfo.h>
 #include <Ice/OutgoingAsync.h>
+#include <Ice/ConnectionFactory.h>
+#include <Ice/Instance.h>
 
 using namespace std;
 using namespace IceInternal;
 
 ConnectionRequestHandler::ConnectionRequestHandler(const ReferencePtr& reference,
                                                    const Ice::ConnectionIPtr& connection,
-                                                   bool compress) :
+                                                   bool compress,
+                                                   bool pooled) :
     RequestHandler(reference),
     _connection(connection),
-    _compress(compress)
+    _compress(compress),
+    _poolGeneration(0)
 {
+    if(pooled)
+    {
+        try
+        {
+            _factory = reference->getInstance()->outgoingConnectionFactory();
+            _poolGeneration = _factory->getConnectionPool(_connection, _pool);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+            // Ignore, invocations will fail with the connection.
+        }
+    }
 }
 
 RequestHandlerPtr
@@ -56,6 +72,26 @@ ConnectionRequestHandler::update(const RequestHandlerPtr& previousHandler, const
 AsyncStatus
 ConnectionRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
 {
+    if(_factory)
+    {
+        //
+        // Spread the invocations over the connections of the pool. The
+        // pool is a snapshot taken when this handler was created. If the
+        // pool changed since then, the proxy request handler is replaced
+        // with a handler for the current pool.
+        //
+        bool stale;
+        Ice::ConnectionIPtr connection = getPooledConnection(stale);
+        if(stale)
+        {
+            _reference->getInstance()->outgoingConnectionFactory(); // Raises CommunicatorDestroyedException.
+            ConnectionRequestHandlerPtr handler =
+                ICE_MAKE_SHARED(ConnectionRequestHandler, _reference, _connection, _compress, true);
+            out->getProxy()->_updateRequestHandler(ICE_SHARED_FROM_THIS, handler);
+            connection = handler->getPooledConnection(stale);
+        }
+        return out->invokeRemote(connection, _compress, _response);
+    }
     return out->invokeRemote(_connection, _compress, _response);
 }
 
@@ -76,3 +112,30 @@ ConnectionRequestHandler::waitForConnection()
 {
     return _connection;
 }
+
+Ice::ConnectionIPtr
+ConnectionRequestHandler::getPooledConnection(bool& stale) const
+{
+    //
+    // Return the least loaded connection of the pool, or the handler
+    // connection if none of the pool connections is still active. The
+    // load is read without locking the connections, it's only a hint.
+    //
+    stale = _factory->getConnectionPoolGeneration() != _poolGeneration;
+    Ice::ConnectionIPtr connection;
+    int load = 0;
+    for(vector<Ice::ConnectionIPtr>::const_iterator p = _pool.begin(); p != _pool.end(); ++p)
+    {
+        int l = (*p)->getLoad();
+        if(l < 0)
+        {
+            stale = true;
+        }
+        else if(!connection || l < load)
+        {
+            connection = *p;
+            load = l;
+        }
+    }
+    return connection ? connection : _connection;
+}
@@ -13,6 +13,8 @@
 #include <Ice/RequestHandler.h>
 #include <Ice/ReferenceF.h>
 #include <Ice/ProxyF.h>
+#include <Ice/ConnectionFactoryF.h>
+#include <Ice/ConnectionIF.h>
 
 namespace IceInternal
 {
@@ -24,7 +26,7 @@ class ConnectionRequestHandler : public RequestHandler
 {
 public:
 
-    ConnectionRequestHandler(const ReferencePtr&, const Ice::ConnectionIPtr&, bool);
+    ConnectionRequestHandler(const ReferencePtr&, const Ice::ConnectionIPtr&, bool, bool);
 
     virtual RequestHandlerPtr update(const RequestHandlerPtr&, const RequestHandlerPtr&);
 
@@ -37,9 +39,15 @@ public:
 
 private:
 
+    Ice::ConnectionIPtr getPooledConnection(bool&) const;
+
     Ice::ConnectionIPtr _connection;
     bool _compress;
+    OutgoingConnectionFactoryPtr _factory; // Set if the connection is pooled.
+    std::vector<Ice::ConnectionIPtr> _pool;
+    int _poolGeneration;
 };
+ICE_DEFINE_PTR(ConnectionRequestHandlerPtr, ConnectionRequestHandler);
 
 }
 
@@ -153,6 +153,16 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
             << properties->getProperty("Ice.Default.LocatorCacheTimeout") << "': defaulting to -1";
     }
 
+    const_cast<int&>(defaultConnectionPoolSize) =
+        properties->getPropertyAsIntWithDefault("Ice.Default.ConnectionPoolSize", 1);
+    if(defaultConnectionPoolSize < 1)
+    {
+        const_cast<Int&>(defaultConnectionPoolSize) = 1;
+        Warning out(logger);
+        out << "invalid value for Ice.Default.ConnectionPoolSize `"
+            << properties->getProperty("Ice.Default.ConnectionPoolSize") << "': defaulting to 1";
+    }
+
     const_cast<bool&>(defaultPreferSecure) =
         properties->getPropertyAsIntWithDefault("Ice.Default.PreferSecure", 0) > 0;
 
@@ -39,6 +39,7 @@ public:
     bool defaultPreferSecure;
     Ice::EncodingVersion defaultEncoding;
     Ice::FormatType defaultFormat;
+    int defaultConnectionPoolSize;
 
     bool overrideTimeout;
     Ice::Int overrideTimeoutValue;
@@ -15,6 +15,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/HashUtil.h>
 #include <Ice/NetworkProxy.h>
+#include <Ice/UniquePtr.h>
 #include <IceUtil/MutexPtrLock.h>
 
 using namespace std;
@@ -218,13 +219,21 @@ IceInternal::IPEndpointI::equivalent(const EndpointIPtr& endpoint) const
 Ice::Int
 IceInternal::IPEndpointI::hash() const
 {
-    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(hashMutex);
-    if(!_hashInitialized)
+    //
+    // The hash is computed once and published with the atomic flag, the
+    // mutex is only locked until it's initialized. This is called for each
+    // connection lookup by the outgoing connection factory.
+    //
+    if(_hashInitialized.load() == 0)
     {
-        _hashValue = 5381;
-        hashAdd(_hashValue, type());
-        hashInit(_hashValue);
-        _hashInitialized = true;
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(hashMutex);
+        if(_hashInitialized.load() == 0)
+        {
+            _hashValue = 5381;
+            hashAdd(_hashValue, type());
+            hashInit(_hashValue);
+            _hashInitialized.exchange(1);
+        }
     }
     return _hashValue;
 }
@@ -509,21 +518,21 @@ IceInternal::IPEndpointI::IPEndpointI(const ProtocolInstancePtr& instance, const
     _port(port),
     _sourceAddr(sourceAddr),
     _connectionId(connectionId),
-    _hashInitialized(false)
+    _hashInitialized(0)
 {
 }
 
 IceInternal::IPEndpointI::IPEndpointI(const ProtocolInstancePtr& instance) :
     _instance(instance),
     _port(0),
-    _hashInitialized(false)
+    _hashInitialized(0)
 {
 }
 
 IceInternal::IPEndpointI::IPEndpointI(const ProtocolInstancePtr& instance, InputStream* s) :
     _instance(instance),
     _port(0),
-    _hashInitialized(false)
+    _hashInitialized(0)
 {
     s->read(const_cast<string&>(_host), false);
     s->read(const_cast<Ice::Int&>(_port));
@@ -532,32 +541,28 @@ IceInternal::IPEndpointI::IPEndpointI(const ProtocolInstancePtr& instance, Input
 #ifndef ICE_OS_UWP
 
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
-    IceUtil::Thread("Ice.HostResolver"),
     _instance(instance),
     _protocol(instance->protocolSupport()),
     _preferIPv6(instance->preferIPv6()),
-    _destroyed(false)
+    _sizeMax(static_cast<size_t>(max(1, instance->initializationData().properties->getPropertyAsIntWithDefault(
+                                            "Ice.HostResolver.SizeMax", 4)))),
+    _cacheTimeout(IceUtil::Time::seconds(max(0, instance->initializationData().properties->getPropertyAsInt(
+                                                    "Ice.HostResolver.CacheTimeout")))),
+    _destroyed(false),
+    _inUse(0),
+    _nextThreadId(0)
 {
     __setNoDelete(true);
     try
     {
-        updateObserver();
-        bool hasPriority = _instance->initializationData().properties->getProperty("Ice.ThreadPriority") != "";
-        int priority = _instance->initializationData().properties->getPropertyAsInt("Ice.ThreadPriority");
-        if(hasPriority)
-        {
-            start(0, priority);
-        }
-        else
-        {
-            start();
-        }
+        Lock sync(*this);
+        startThread();
     }
     catch(const IceUtil::Exception& ex)
     {
         {
             Ice::Error out(_instance->initializationData().logger);
-            out << "cannot create thread for enpoint host resolver:\n" << ex;
+            out << "cannot create thread for endpoint host resolver:\n" << ex;
         }
         throw;
     }
@@ -570,7 +575,7 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
 {
     //
     // Try to get the addresses without DNS lookup. If this doesn't work, we queue a resolve
-    // entry and the thread will take care of getting the endpoint addresses.
+    // entry and the threads will take care of getting the endpoint addresses.
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if(!networkProxy)
@@ -591,45 +596,151 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         }
     }
 
-    Lock sync(*this);
-    assert(!_destroyed);
+    HostKey key = make_pair(host, port);
+    vector<Address> addresses;
+    {
+        Lock sync(*this);
+        assert(!_destroyed);
 
-    ResolveEntry entry;
-    entry.host = host;
-    entry.port = port;
-    entry.selType = selType;
-    entry.endpoint = endpoint;
-    entry.callback = callback;
+        //
+        // Use the addresses from the cache if the host was resolved recently.
+        //
+        map<HostKey, CacheEntry>::iterator p = _cache.find(key);
+        if(p != _cache.end() && p->second.expirationTime < IceUtil::Time::now(IceUtil::Time::Monotonic))
+        {
+            _cache.erase(p);
+            p = _cache.end();
+        }
 
-    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
-    if(obsv)
-    {
-        entry.observer = obsv->getEndpointLookupObserver(endpoint);
-        if(entry.observer)
+        if(p != _cache.end())
         {
-            entry.observer->attach();
+            addresses = p->second.addresses;
+            networkProxy = p->second.networkProxy;
+        }
+        else
+        {
+            ResolveEntry entry;
+            entry.selType = selType;
+            entry.endpoint = endpoint;
+            entry.callback = callback;
+
+            const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
+            if(obsv)
+            {
+                entry.observer = obsv->getEndpointLookupObserver(endpoint);
+                if(entry.observer)
+                {
+                    entry.observer->attach();
+                }
+            }
+
+            //
+            // If a lookup for the same host and port is already in progress, the entry
+            // waits for its result. Otherwise, the host is queued and an additional
+            // thread is started if all the threads are busy.
+            //
+            vector<ResolveEntry>& entries = _pending[key];
+            entries.push_back(entry);
+            if(entries.size() == 1)
+            {
+                _queue.push_back(key);
+                if(_threads.size() - _inUse < _queue.size() && _threads.size() < _sizeMax)
+                {
+                    try
+                    {
+                        startThread();
+                    }
+                    catch(const IceUtil::Exception& ex)
+                    {
+                        Ice::Error out(_instance->initializationData().logger);
+                        out << "cannot create thread for endpoint host resolver:\n" << ex;
+                    }
+                }
+                notify();
+            }
+            return;
         }
     }
 
-    _queue.push_back(entry);
-    notify();
+    try
+    {
+        sortAddresses(addresses, _protocol, selType, _preferIPv6);
+        callback->connectors(endpoint->connectors(addresses, networkProxy));
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        callback->exception(ex);
+    }
 }
 
 void
 IceInternal::EndpointHostResolver::destroy()
+{
+    vector<ResolveEntry> entries;
+    {
+        Lock sync(*this);
+        assert(!_destroyed);
+        _destroyed = true;
+        notifyAll();
+
+        //
+        // The hosts which are still queued won't be resolved. The entries waiting
+        // for a lookup in progress are notified by the thread doing the lookup.
+        //
+        for(deque<HostKey>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
+        {
+            map<HostKey, vector<ResolveEntry> >::iterator q = _pending.find(*p);
+            assert(q != _pending.end());
+            entries.insert(entries.end(), q->second.begin(), q->second.end());
+            _pending.erase(q);
+        }
+        _queue.clear();
+    }
+
+    for(vector<ResolveEntry>::const_iterator p = entries.begin(); p != entries.end(); ++p)
+    {
+        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
+        if(p->observer)
+        {
+            p->observer->failed(ex.ice_id());
+            p->observer->detach();
+        }
+        p->callback->exception(ex);
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::joinWithAllThreads()
+{
+    //
+    // No need to serialize, the threads are only added while the
+    // resolver isn't destroyed.
+    //
+    for(vector<HelperThreadPtr>::iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+    _threads.clear();
+    assert(_pending.empty());
+    _cache.clear();
+}
+
+void
+IceInternal::EndpointHostResolver::updateObserver()
 {
     Lock sync(*this);
-    assert(!_destroyed);
-    _destroyed = true;
-    notify();
+    for(vector<HelperThreadPtr>::iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->updateObserver();
+    }
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::run(const HelperThreadPtr& thread)
 {
     while(true)
     {
-        ResolveEntry r;
+        HostKey key;
         ThreadObserverPtr threadObserver;
         {
             Lock sync(*this);
@@ -643,9 +754,10 @@ IceInternal::EndpointHostResolver::run()
                 break;
             }
 
-            r = _queue.front();
+            key = _queue.front();
             _queue.pop_front();
-            threadObserver = _observer.get();
+            ++_inUse;
+            threadObserver = thread->getObserver();
         }
 
         if(threadObserver)
@@ -653,9 +765,16 @@ IceInternal::EndpointHostResolver::run()
             threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateIdle), ICE_ENUM(ThreadState, ThreadStateInUseForOther));
         }
 
+        //
+        // The lookup is done with the ordered selection type, the addresses are
+        // sorted according to the selection type of each waiting entry.
+        //
+        vector<Address> addresses;
+        NetworkProxyPtr networkProxy;
+        IceInternal::UniquePtr<Ice::LocalException> exception;
         try
         {
-            NetworkProxyPtr networkProxy = _instance->networkProxy();
+            networkProxy = _instance->networkProxy();
             ProtocolSupport protocol = _protocol;
             if(networkProxy)
             {
@@ -666,49 +785,108 @@ IceInternal::EndpointHostResolver::run()
                 }
             }
 
-            vector<Address> addresses = getAddresses(r.host, r.port, protocol, r.selType, _preferIPv6, true);
-            if(r.observer)
-            {
-                r.observer->detach();
-                r.observer = 0;
-            }
+            addresses = getAddresses(key.first, key.second, protocol, Ice::ICE_ENUM(EndpointSelectionType, Ordered),
+                                     _preferIPv6, true);
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            ICE_SET_EXCEPTION_FROM_CLONE(exception, ex.ice_clone());
+        }
+
+        vector<ResolveEntry> entries;
+        {
+            Lock sync(*this);
+            --_inUse;
 
-            r.callback->connectors(r.endpoint->connectors(addresses, networkProxy));
+            map<HostKey, vector<ResolveEntry> >::iterator p = _pending.find(key);
+            assert(p != _pending.end());
+            entries.swap(p->second);
+            _pending.erase(p);
 
-            if(threadObserver)
+            if(!exception.get() && _cacheTimeout > IceUtil::Time())
             {
-                threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
-                                             ICE_ENUM(ThreadState, ThreadStateIdle));
+                CacheEntry& cached = _cache[key];
+                cached.addresses = addresses;
+                cached.networkProxy = networkProxy;
+                cached.expirationTime = IceUtil::Time::now(IceUtil::Time::Monotonic) + _cacheTimeout;
             }
-
         }
-        catch(const Ice::LocalException& ex)
+
+        for(vector<ResolveEntry>::const_iterator p = entries.begin(); p != entries.end(); ++p)
         {
-            if(threadObserver)
+            try
             {
-                threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
-                                             ICE_ENUM(ThreadState, ThreadStateIdle));
+                if(exception.get())
+                {
+                    exception->ice_throw();
+                }
+
+                if(p->observer)
+                {
+                    p->observer->detach();
+                }
+
+                vector<Address> addrs = addresses;
+                sortAddresses(addrs, _protocol, p->selType, _preferIPv6);
+                p->callback->connectors(p->endpoint->connectors(addrs, networkProxy));
             }
-            if(r.observer)
+            catch(const Ice::LocalException& ex)
             {
-                r.observer->failed(ex.ice_id());
-                r.observer->detach();
+                if(exception.get() && p->observer)
+                {
+                    p->observer->failed(ex.ice_id());
+                    p->observer->detach();
+                }
+                p->callback->exception(ex);
             }
-            r.callback->exception(ex);
         }
-    }
 
-    for(deque<ResolveEntry>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
-    {
-        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
-        if(p->observer)
+        if(threadObserver)
         {
-            p->observer->failed(ex.ice_id());
-            p->observer->detach();
+            threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
+                                         ICE_ENUM(ThreadState, ThreadStateIdle));
         }
-        p->callback->exception(ex);
     }
-    _queue.clear();
+}
+
+void
+IceInternal::EndpointHostResolver::startThread()
+{
+    // Must be called with the mutex locked.
+    ostringstream os;
+    os << "Ice.HostResolver";
+    if(_nextThreadId > 0)
+    {
+        os << "-" << _nextThreadId;
+    }
+    ++_nextThreadId;
+
+    HelperThreadPtr thread = new HelperThread(this, os.str());
+    bool hasPriority = _instance->initializationData().properties->getProperty("Ice.ThreadPriority") != "";
+    int priority = _instance->initializationData().properties->getPropertyAsInt("Ice.ThreadPriority");
+    if(hasPriority)
+    {
+        thread->start(0, priority);
+    }
+    else
+    {
+        thread->start();
+    }
+    _threads.push_back(thread);
+}
+
+IceInternal::EndpointHostResolver::HelperThread::HelperThread(const EndpointHostResolverPtr& resolver,
+                                                             const string& name) :
+    IceUtil::Thread(name),
+    _resolver(resolver)
+{
+    updateObserver();
+}
+
+void
+IceInternal::EndpointHostResolver::HelperThread::run()
+{
+    _resolver->run(this);
 
     if(_observer)
     {
@@ -717,10 +895,10 @@ IceInternal::EndpointHostResolver::run()
 }
 
 void
-IceInternal::EndpointHostResolver::updateObserver()
+IceInternal::EndpointHostResolver::HelperThread::updateObserver()
 {
-    Lock sync(*this);
-    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
+    // Must be called with the resolver mutex locked.
+    const CommunicatorObserverPtr& obsv = _resolver->_instance->initializationData().observer;
     if(obsv)
     {
         _observer.attach(obsv->getThreadObserver("Communicator",
@@ -730,6 +908,13 @@ IceInternal::EndpointHostResolver::updateObserver()
     }
 }
 
+ThreadObserverPtr
+IceInternal::EndpointHostResolver::HelperThread::getObserver() const
+{
+    // Must be called with the resolver mutex locked.
+    return _observer.get();
+}
+
 #else
 
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
@@ -761,7 +946,7 @@ IceInternal::EndpointHostResolver::destroy()
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::joinWithAllThreads()
 {
 }
 
@@ -14,6 +14,7 @@
 #include <IceUtil/Shared.h>
 #include <IceUtil/Thread.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Atomic.h>
 #include <Ice/IPEndpointIF.h>
 #include <Ice/EndpointI.h>
 #include <Ice/Network.h>
@@ -22,6 +23,7 @@
 
 #ifndef ICE_OS_UWP
 #   include <deque>
+#   include <map>
 #endif
 
 namespace IceInternal
@@ -105,12 +107,12 @@ protected:
 
 private:
 
-    mutable bool _hashInitialized;
+    mutable IceUtilInternal::Atomic _hashInitialized;
     mutable Ice::Int _hashValue;
 };
 
 #ifndef ICE_OS_UWP
-class ICE_API EndpointHostResolver : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+class ICE_API EndpointHostResolver : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 #else
 class ICE_API EndpointHostResolver : public IceUtil::Shared
 #endif
@@ -122,29 +124,63 @@ public:
     void resolve(const std::string&, int, Ice::EndpointSelectionType, const IPEndpointIPtr&,
                  const EndpointI_connectorsPtr&);
     void destroy();
+    void joinWithAllThreads();
 
-    virtual void run();
     void updateObserver();
 
 private:
 
 #ifndef ICE_OS_UWP
+    class HelperThread : public IceUtil::Thread
+    {
+    public:
+
+        HelperThread(const EndpointHostResolverPtr&, const std::string&);
+        virtual void run();
+
+        void updateObserver();
+        Ice::Instrumentation::ThreadObserverPtr getObserver() const;
+
+    private:
+
+        EndpointHostResolverPtr _resolver;
+        ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    };
+    typedef IceUtil::Handle<HelperThread> HelperThreadPtr;
+    friend class HelperThread;
+
     struct ResolveEntry
     {
-        std::string host;
-        int port;
         Ice::EndpointSelectionType selType;
         IPEndpointIPtr endpoint;
         EndpointI_connectorsPtr callback;
         Ice::Instrumentation::ObserverPtr observer;
     };
 
+    struct CacheEntry
+    {
+        std::vector<Address> addresses;
+        NetworkProxyPtr networkProxy;
+        IceUtil::Time expirationTime;
+    };
+
+    typedef std::pair<std::string, int> HostKey;
+
+    void run(const HelperThreadPtr&);
+    void startThread();
+
     const InstancePtr _instance;
     const IceInternal::ProtocolSupport _protocol;
     const bool _preferIPv6;
+    const size_t _sizeMax;
+    const IceUtil::Time _cacheTimeout;
     bool _destroyed;
-    std::deque<ResolveEntry> _queue;
-    ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    std::deque<HostKey> _queue;
+    std::map<HostKey, std::vector<ResolveEntry> > _pending;
+    std::map<HostKey, CacheEntry> _cache;
+    std::vector<HelperThreadPtr> _threads;
+    size_t _inUse;
+    int _nextThreadId;
 #else
     const InstancePtr _instance;
 #endif
@@ -52,6 +52,7 @@ IceInternal::IncomingBase::IncomingBase(Instance* instance, ResponseHandler* res
                                         bool response, Byte compress, Int requestId) :
     _response(response),
     _compress(compress),
+    _priority(false),
     _format(Ice::ICE_ENUM(FormatType, DefaultFormat)),
     _os(instance, Ice::currentProtocolEncoding),
     _responseHandler(responseHandler)
@@ -73,6 +74,7 @@ IceInternal::IncomingBase::IncomingBase(IncomingBase& other) :
     _cookie(other._cookie),
     _response(other._response),
     _compress(other._compress),
+    _priority(other._priority),
     _format(other._format),
     _os(other._os.instance(), Ice::currentProtocolEncoding),
     _responseHandler(other._responseHandler),
@@ -167,7 +169,7 @@ IceInternal::IncomingBase::response(bool amd)
         if(_response)
         {
             _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
-            _responseHandler->sendResponse(_current.requestId, &_os, _compress, amd);
+            _responseHandler->sendResponse(_current.requestId, &_os, _compress, _priority, amd);
         }
         else
         {
@@ -382,7 +384,7 @@ IceInternal::IncomingBase::handleException(const std::exception& exc, bool amd)
             _os.write(rfe->operation, false);
 
             _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
-            _responseHandler->sendResponse(_current.requestId, &_os, _compress, amd);
+            _responseHandler->sendResponse(_current.requestId, &_os, _compress, _priority, amd);
         }
         else
         {
@@ -405,7 +407,7 @@ IceInternal::IncomingBase::handleException(const std::exception& exc, bool amd)
             _os.write(*ex);
             _os.endEncapsulation();
             _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
-            _responseHandler->sendResponse(_current.requestId, &_os, _compress, amd);
+            _responseHandler->sendResponse(_current.requestId, &_os, _compress, _priority, amd);
         }
         else
         {
@@ -478,7 +480,7 @@ IceInternal::IncomingBase::handleException(const std::exception& exc, bool amd)
             }
 
             _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
-            _responseHandler->sendResponse(_current.requestId, &_os, _compress, amd);
+            _responseHandler->sendResponse(_current.requestId, &_os, _compress, _priority, amd);
         }
         else
         {
@@ -507,7 +509,7 @@ IceInternal::IncomingBase::handleException(const std::exception& exc, bool amd)
             _os.write(str.str(), false);
 
             _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
-            _responseHandler->sendResponse(_current.requestId, &_os, _compress, amd);
+            _responseHandler->sendResponse(_current.requestId, &_os, _compress, _priority, amd);
         }
         else
         {
@@ -547,7 +549,7 @@ IceInternal::IncomingBase::handleException(const string& msg, bool amd)
         string reason = msg;
         _os.write(reason, false);
         _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
-        _responseHandler->sendResponse(_current.requestId, &_os, _compress, amd);
+        _responseHandler->sendResponse(_current.requestId, &_os, _compress, _priority, amd);
     }
     else
     {
@@ -623,22 +625,19 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
     _is->read(_current.id);
 
     //
-    // For compatibility with the old FacetPath.
+    // For compatibility with the old FacetPath. The facet path is a
+    // sequence with at most one element, we read it directly into the
+    // current rather than going through a temporary vector.
     //
-    string facet;
+    Int sz = _is->readSize();
+    if(sz > 1)
     {
-        vector<string> facetPath;
-        _is->read(facetPath);
-        if(!facetPath.empty())
-        {
-            if(facetPath.size() > 1)
-            {
-                throw MarshalException(__FILE__, __LINE__);
-            }
-            facet.swap(facetPath[0]);
-        }
+        throw MarshalException(__FILE__, __LINE__);
+    }
+    else if(sz == 1)
+    {
+        _is->read(_current.facet);
     }
-    _current.facet.swap(facet);
 
     _is->read(_current.operation, false);
 
@@ -646,24 +645,37 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
     _is->read(b);
     _current.mode = static_cast<OperationMode>(b);
 
-    Int sz = _is->readSize();
-    while(sz--)
+    //
+    // Unmarshal the context entries in place: the key is read into a
+    // local string and the value directly into the new map entry, to
+    // avoid copying both strings through a temporary pair.
+    //
+    sz = _is->readSize();
+    if(sz > 0)
     {
-        pair<const string, string> pr;
-        _is->read(const_cast<string&>(pr.first));
-        _is->read(pr.second);
-        _current.ctx.insert(_current.ctx.end(), pr);
+        string key;
+        while(sz--)
+        {
+            _is->read(key);
+            Context::iterator p = _current.ctx.insert(_current.ctx.end(), Context::value_type(key, string()));
+            _is->read(p->second);
+        }
+
+        //
+        // The reply of a priority request has priority as well.
+        //
+        _priority = _current.ctx.find(priorityContextKey) != _current.ctx.end();
     }
 
     const CommunicatorObserverPtr& obsv = _is->instance()->initializationData().observer;
     if(obsv)
     {
         // Read the parameter encapsulation size.
-        Ice::Int sz;
-        _is->read(sz);
+        Ice::Int encapsSz;
+        _is->read(encapsSz);
         _is->i -= 4;
 
-        _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + sz)));
+        _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + encapsSz)));
     }
 
     //
@@ -1147,7 +1147,11 @@ Ice::InputStream::read(std::string& v, bool convert)
 
         if(!convert || !readConverted(v, sz))
         {
-            string(reinterpret_cast<const char*>(&*i), reinterpret_cast<const char*>(&*i) + sz).swap(v);
+            //
+            // Assign rather than swap with a temporary so that the
+            // capacity of a reused string is kept.
+            //
+            v.assign(reinterpret_cast<const char*>(&*i), static_cast<size_t>(sz));
         }
         i += sz;
     }
@@ -949,6 +949,7 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
     _batchAutoFlushSize(0),
     _classGraphDepthMax(0),
     _collectObjects(false),
+    _cacheMessageBuffers(false),
     _toStringMode(ICE_ENUM(ToStringMode, Unicode)),
     _implicitContext(0),
     _stringConverter(Ice::getProcessStringConverter()),
@@ -1189,6 +1190,9 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
 
         const_cast<bool&>(_collectObjects) = _initData.properties->getPropertyAsInt("Ice.CollectObjects") > 0;
 
+        const_cast<bool&>(_cacheMessageBuffers) =
+            _initData.properties->getPropertyAsIntWithDefault("Ice.CacheMessageBuffers", 1) > 0;
+
         string toStringModeStr = _initData.properties->getPropertyWithDefault("Ice.ToStringMode", "Unicode");
         if(toStringModeStr == "ASCII")
         {
@@ -1212,7 +1216,7 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
 #endif
         _routerManager = new RouterManager;
 
-        _locatorManager = new LocatorManager(_initData.properties);
+        _locatorManager = new LocatorManager(this);
 
         _referenceFactory = new ReferenceFactory(this, communicator);
 
@@ -1648,12 +1652,10 @@ IceInternal::Instance::destroy()
     {
         _serverThreadPool->joinWithAllThreads();
     }
-#ifndef ICE_OS_UWP
     if(_endpointHostResolver)
     {
-        _endpointHostResolver->getThreadControl().join();
+        _endpointHostResolver->joinWithAllThreads();
     }
-#endif
 
     for_each(_objectFactoryMap.begin(), _objectFactoryMap.end(),
         Ice::secondVoidMemFun<const string, ObjectFactory>(&ObjectFactory::destroy));
@@ -110,6 +110,7 @@ public:
     size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
     size_t classGraphDepthMax() const { return _classGraphDepthMax; }
     bool collectObjects() const { return _collectObjects; }
+    bool cacheMessageBuffers() const { return _cacheMessageBuffers; }
     Ice::ToStringMode toStringMode() const { return _toStringMode; }
     const ACMConfig& clientACM() const;
     const ACMConfig& serverACM() const;
@@ -179,6 +180,7 @@ private:
     const size_t _batchAutoFlushSize; // Immutable, not reset by destroy().
     const size_t _classGraphDepthMax; // Immutable, not reset by destroy().
     const bool _collectObjects; // Immutable, not reset by destroy().
+    const bool _cacheMessageBuffers; // Immutable, not reset by destroy().
     const Ice::ToStringMode _toStringMode; // Immutable, not reset by destroy()
     ACMConfig _clientACM;
     ACMConfig _serverACM;
@@ -8,6 +8,8 @@
 // **********************************************************************
 
 #include <IceUtil/DisableWarnings.h>
+#include <IceUtil/FileUtil.h>
+#include <IceUtil/StringUtil.h>
 #include <Ice/LocatorInfo.h>
 #include <Ice/Locator.h>
 #include <Ice/LocalException.h>
@@ -19,7 +21,13 @@
 #include <Ice/Functional.h>
 #include <Ice/Properties.h>
 #include <Ice/Comparable.h>
+#include <Ice/InputStream.h>
+#include <Ice/OutputStream.h>
+#include <Ice/HashUtil.h>
+#include <Ice/EndpointFactoryManager.h>
+#include <Ice/ReferenceFactory.h>
 #include <iterator>
+#include <fstream>
 
 using namespace std;
 using namespace Ice;
@@ -127,8 +135,14 @@ public:
 
 }
 
-IceInternal::LocatorManager::LocatorManager(const Ice::PropertiesPtr& properties) :
-    _background(properties->getPropertyAsInt("Ice.BackgroundLocatorCacheUpdates") > 0),
+IceInternal::LocatorManager::LocatorManager(const InstancePtr& instance) :
+    _instance(instance),
+    _background(instance->initializationData().properties->getPropertyAsInt("Ice.BackgroundLocatorCacheUpdates") > 0),
+    _refreshThreshold(instance->initializationData().properties->getPropertyAsInt("Ice.LocatorCacheRefreshThreshold")),
+    _notRegisteredTimeout(
+        instance->initializationData().properties->getPropertyAsInt("Ice.LocatorCacheNotRegisteredTimeout")),
+    _cacheFile(instance->initializationData().properties->getProperty("Ice.LocatorCacheFile")),
+    _cacheLoaded(false),
     _tableHint(_table.end())
 {
 }
@@ -138,6 +152,14 @@ IceInternal::LocatorManager::destroy()
 {
     IceUtil::Mutex::Lock sync(*this);
 
+    //
+    // Save the cache before the locator infos clear their table.
+    //
+    if(!_cacheFile.empty())
+    {
+        saveCache();
+    }
+
 #ifdef ICE_CPP11_MAPPING
     for_each(_table.begin(), _table.end(), [](pair<shared_ptr<Ice::LocatorPrx>, LocatorInfoPtr> it){ it.second->destroy(); });
 #else
@@ -147,6 +169,7 @@ IceInternal::LocatorManager::destroy()
     _tableHint = _table.end();
 
     _locatorTables.clear();
+    _instance = 0;
 }
 
 LocatorInfoPtr
@@ -163,81 +186,210 @@ IceInternal::LocatorManager::get(const LocatorPrxPtr& loc)
     // TODO: reap unused locator info objects?
     //
 
-    IceUtil::Mutex::Lock sync(*this);
+    bool loadCache = false;
+    LocatorInfoPtr info;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+
+        LocatorInfoTable::iterator p = _table.end();
+
+        if(_tableHint != _table.end())
+        {
+            if(targetEqualTo(_tableHint->first, locator))
+            {
+                p = _tableHint;
+            }
+        }
+
+        if(p == _table.end())
+        {
+            p = _table.find(locator);
+        }
+
+        if(p == _table.end())
+        {
+            //
+            // Rely on locator identity for the adapter table. We want to
+            // have only one table per locator (not one per locator
+            // proxy).
+            //
+            pair<Identity, EncodingVersion> locatorKey(locator->ice_getIdentity(), locator->ice_getEncodingVersion());
+            _tableHint = _table.insert(_tableHint,
+                                       pair<const LocatorPrxPtr, LocatorInfoPtr>(locator,
+                                                                                 new LocatorInfo(locator,
+                                                                                                 getLocatorTable(locatorKey),
+                                                                                                 _background)));
+        }
+        else
+        {
+            _tableHint = p;
+        }
+        info = _tableHint->second;
 
-    LocatorInfoTable::iterator p = _table.end();
+        if(!_cacheFile.empty() && !_cacheLoaded)
+        {
+            _cacheLoaded = true;
+            loadCache = true;
+        }
+    }
 
-    if(_tableHint != _table.end())
+    //
+    // Load the persisted cache without the mutex locked: parsing the
+    // cached proxies might call back on the locator manager.
+    //
+    if(loadCache)
     {
-        if(targetEqualTo(_tableHint->first, locator))
+        this->loadCache();
+    }
+    return info;
+}
+
+LocatorTablePtr
+IceInternal::LocatorManager::getLocatorTable(const pair<Identity, EncodingVersion>& locatorKey)
+{
+    map<pair<Identity, EncodingVersion>, LocatorTablePtr>::iterator t = _locatorTables.find(locatorKey);
+    if(t == _locatorTables.end())
+    {
+        t = _locatorTables.insert(_locatorTables.begin(),
+                                  pair<const pair<Identity, EncodingVersion>, LocatorTablePtr>(
+                                      locatorKey, new LocatorTable(_refreshThreshold, _notRegisteredTimeout)));
+    }
+    return t->second;
+}
+
+void
+IceInternal::LocatorManager::loadCache()
+{
+    InstancePtr instance;
+    vector<Byte> bytes;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(!_instance)
         {
-            p = _tableHint;
+            return;
         }
+        instance = _instance;
     }
 
-    if(p == _table.end())
+    ifstream is(IceUtilInternal::streamFilename(_cacheFile).c_str(), ios::in | ios::binary);
+    if(!is.good())
     {
-        p = _table.find(locator);
+        return; // The cache wasn't saved yet.
     }
+    bytes.assign(istreambuf_iterator<char>(is), istreambuf_iterator<char>());
 
-    if(p == _table.end())
+    try
     {
-        //
-        // Rely on locator identity for the adapter table. We want to
-        // have only one table per locator (not one per locator
-        // proxy).
-        //
-        pair<Identity, EncodingVersion> locatorKey(locator->ice_getIdentity(), locator->ice_getEncodingVersion());
-        map<pair<Identity, EncodingVersion>, LocatorTablePtr>::iterator t = _locatorTables.find(locatorKey);
-        if(t == _locatorTables.end())
+        Ice::InputStream in(bytes);
+        string magic;
+        in.read(magic);
+        if(magic != "IceLocatorCache")
         {
-            t = _locatorTables.insert(_locatorTables.begin(),
-                                      pair<const pair<Identity, EncodingVersion>, LocatorTablePtr>(
-                                          locatorKey, new LocatorTable()));
+            throw Ice::MarshalException(__FILE__, __LINE__, "invalid locator cache file");
         }
 
-        _tableHint = _table.insert(_tableHint,
-                                   pair<const LocatorPrxPtr, LocatorInfoPtr>(locator,
-                                                                          new LocatorInfo(locator, t->second,
-                                                                                          _background)));
+        Int sz = in.readSize();
+        while(sz-- > 0)
+        {
+            pair<Identity, EncodingVersion> locatorKey;
+            in.read(locatorKey.first);
+            in.read(locatorKey.second);
+
+            LocatorTablePtr table;
+            {
+                IceUtil::Mutex::Lock sync(*this);
+                table = getLocatorTable(locatorKey);
+            }
+            table->load(&in, instance);
+        }
+
+        if(instance->traceLevels()->location >= 1)
+        {
+            Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+            out << "loaded locator cache from `" << _cacheFile << "'";
+        }
     }
-    else
+    catch(const Ice::LocalException& ex)
     {
-        _tableHint = p;
+        Warning out(instance->initializationData().logger);
+        out << "couldn't load the locator cache from `" << _cacheFile << "':\n" << ex;
     }
+}
 
-    return _tableHint->second;
+void
+IceInternal::LocatorManager::saveCache()
+{
+    //
+    // Called with the mutex locked.
+    //
+    Ice::OutputStream stream;
+    stream.write(string("IceLocatorCache"));
+    stream.writeSize(static_cast<Int>(_locatorTables.size()));
+    for(map<pair<Identity, EncodingVersion>, LocatorTablePtr>::const_iterator p = _locatorTables.begin();
+        p != _locatorTables.end(); ++p)
+    {
+        stream.write(p->first.first);
+        stream.write(p->first.second);
+        p->second->save(&stream);
+    }
+
+    const string tmpFile = _cacheFile + ".tmp";
+    ofstream os(IceUtilInternal::streamFilename(tmpFile).c_str(), ios::out | ios::binary | ios::trunc);
+    if(os.good())
+    {
+        os.write(reinterpret_cast<const char*>(stream.b.begin()), static_cast<streamsize>(stream.b.size()));
+        os.close();
+    }
+
+    //
+    // Write to a temporary file and rename it so that a crash never
+    // leaves a truncated cache file behind.
+    //
+    if(!os.good() || IceUtilInternal::rename(tmpFile, _cacheFile) != 0)
+    {
+        IceUtilInternal::unlink(tmpFile);
+        Warning out(_instance->initializationData().logger);
+        out << "couldn't save the locator cache to `" << _cacheFile << "':\n" << IceUtilInternal::lastErrorToString();
+    }
 }
 
-IceInternal::LocatorTable::LocatorTable()
+IceInternal::LocatorTable::LocatorTable(int refreshThreshold, int notRegisteredTimeout) :
+    _refreshThreshold(refreshThreshold > 0 && refreshThreshold < 100 ? refreshThreshold : 0),
+    _notRegisteredTimeout(IceUtil::Time::seconds(notRegisteredTimeout > 0 ? notRegisteredTimeout : 0))
 {
 }
 
 void
 IceInternal::LocatorTable::clear()
 {
-     IceUtil::Mutex::Lock sync(*this);
-
-     _adapterEndpointsMap.clear();
-     _objectMap.clear();
+    for(size_t i = 0; i < _shards.size(); ++i)
+    {
+        IceUtil::Mutex::Lock sync(_shards[i].mutex);
+        _shards[i].adapterEndpointsMap.clear();
+        _shards[i].objectMap.clear();
+        _shards[i].adapterNotRegisteredMap.clear();
+        _shards[i].objectNotRegisteredMap.clear();
+    }
 }
 
 bool
-IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, vector<EndpointIPtr>& endpoints)
+IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, vector<EndpointIPtr>& endpoints,
+                                               bool& refresh)
 {
     if(ttl == 0) // No locator cache.
     {
         return false;
     }
 
-    IceUtil::Mutex::Lock sync(*this);
+    Shard& s = shard(adapter);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = s.adapterEndpointsMap.find(adapter);
 
-    if(p != _adapterEndpointsMap.end())
+    if(p != s.adapterEndpointsMap.end())
     {
         endpoints = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        return checkTTL(p->second.first, ttl, refresh);
     }
     return false;
 }
@@ -245,55 +397,59 @@ IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, v
 void
 IceInternal::LocatorTable::addAdapterEndpoints(const string& adapter, const vector<EndpointIPtr>& endpoints)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    Shard& s = shard(adapter);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = s.adapterEndpointsMap.find(adapter);
 
-    if(p != _adapterEndpointsMap.end())
+    if(p != s.adapterEndpointsMap.end())
     {
         p->second = make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), endpoints);
     }
     else
     {
-        _adapterEndpointsMap.insert(
+        s.adapterEndpointsMap.insert(
             make_pair(adapter, make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), endpoints)));
     }
+    s.adapterNotRegisteredMap.erase(adapter);
 }
 
 vector<EndpointIPtr>
 IceInternal::LocatorTable::removeAdapterEndpoints(const string& adapter)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    Shard& s = shard(adapter);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
-    if(p == _adapterEndpointsMap.end())
+    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = s.adapterEndpointsMap.find(adapter);
+    if(p == s.adapterEndpointsMap.end())
     {
         return vector<EndpointIPtr>();
     }
 
     vector<EndpointIPtr> endpoints = p->second.second;
 
-    _adapterEndpointsMap.erase(p);
+    s.adapterEndpointsMap.erase(p);
 
     return endpoints;
 }
 
 bool
-IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, ReferencePtr& ref)
+IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, ReferencePtr& ref, bool& refresh)
 {
     if(ttl == 0) // No locator cache
     {
         return false;
     }
 
-    IceUtil::Mutex::Lock sync(*this);
+    Shard& s = shard(id);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = s.objectMap.find(id);
 
-    if(p != _objectMap.end())
+    if(p != s.objectMap.end())
     {
         ref = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        return checkTTL(p->second.first, ttl, refresh);
     }
     return false;
 }
@@ -301,38 +457,184 @@ IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, Refer
 void
 IceInternal::LocatorTable::addObjectReference(const Identity& id, const ReferencePtr& ref)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    Shard& s = shard(id);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = s.objectMap.find(id);
 
-    if(p != _objectMap.end())
+    if(p != s.objectMap.end())
     {
         p->second = make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), ref);
     }
     else
     {
-        _objectMap.insert(make_pair(id, make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), ref)));
+        s.objectMap.insert(make_pair(id, make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), ref)));
     }
+    s.objectNotRegisteredMap.erase(id);
 }
 
 ReferencePtr
 IceInternal::LocatorTable::removeObjectReference(const Identity& id)
 {
-    IceUtil::Mutex::Lock sync(*this);
+    Shard& s = shard(id);
+    IceUtil::Mutex::Lock sync(s.mutex);
 
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
-    if(p == _objectMap.end())
+    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = s.objectMap.find(id);
+    if(p == s.objectMap.end())
     {
         return 0;
     }
 
     ReferencePtr ref = p->second.second;
-    _objectMap.erase(p);
+    s.objectMap.erase(p);
     return ref;
 }
 
 bool
-IceInternal::LocatorTable::checkTTL(const IceUtil::Time& time, int ttl) const
+IceInternal::LocatorTable::isAdapterNotRegistered(const string& adapter, int ttl)
+{
+    if(ttl == 0 || _notRegisteredTimeout == IceUtil::Time())
+    {
+        return false;
+    }
+
+    Shard& s = shard(adapter);
+    IceUtil::Mutex::Lock sync(s.mutex);
+    return checkNotRegistered(s.adapterNotRegisteredMap, adapter);
+}
+
+void
+IceInternal::LocatorTable::addAdapterNotRegistered(const string& adapter)
+{
+    if(_notRegisteredTimeout == IceUtil::Time())
+    {
+        return;
+    }
+
+    Shard& s = shard(adapter);
+    IceUtil::Mutex::Lock sync(s.mutex);
+    addNotRegistered(s.adapterNotRegisteredMap, adapter);
+}
+
+bool
+IceInternal::LocatorTable::isObjectNotRegistered(const Identity& id, int ttl)
+{
+    if(ttl == 0 || _notRegisteredTimeout == IceUtil::Time())
+    {
+        return false;
+    }
+
+    Shard& s = shard(id);
+    IceUtil::Mutex::Lock sync(s.mutex);
+    return checkNotRegistered(s.objectNotRegisteredMap, id);
+}
+
+void
+IceInternal::LocatorTable::addObjectNotRegistered(const Identity& id)
+{
+    if(_notRegisteredTimeout == IceUtil::Time())
+    {
+        return;
+    }
+
+    Shard& s = shard(id);
+    IceUtil::Mutex::Lock sync(s.mutex);
+    addNotRegistered(s.objectNotRegisteredMap, id);
+}
+
+void
+IceInternal::LocatorTable::load(Ice::InputStream* in, const InstancePtr& instance)
+{
+    map<string, vector<string> > adapters;
+    map<Identity, string> objects;
+    in->read(adapters);
+    in->read(objects);
+
+    //
+    // The loaded entries are considered fresh. If the endpoints are
+    // outdated, the invocation fails to connect and clears the entry
+    // as it does for any other cached endpoints.
+    //
+    for(map<string, vector<string> >::const_iterator p = adapters.begin(); p != adapters.end(); ++p)
+    {
+        vector<EndpointIPtr> endpoints;
+        for(vector<string>::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+        {
+            EndpointIPtr endpoint = instance->endpointFactoryManager()->create(*q, false);
+            if(endpoint)
+            {
+                endpoints.push_back(endpoint);
+            }
+        }
+        if(!endpoints.empty())
+        {
+            addAdapterEndpoints(p->first, endpoints);
+        }
+    }
+
+    for(map<Identity, string>::const_iterator p = objects.begin(); p != objects.end(); ++p)
+    {
+        try
+        {
+            ReferencePtr ref = instance->referenceFactory()->create(p->second, "");
+            if(ref)
+            {
+                addObjectReference(p->first, ref);
+            }
+        }
+        catch(const Ice::LocalException&)
+        {
+            // Ignore proxies which can't be parsed anymore (unknown transport, etc).
+        }
+    }
+}
+
+void
+IceInternal::LocatorTable::save(Ice::OutputStream* out) const
+{
+    map<string, vector<string> > adapters;
+    map<Identity, string> objects;
+    for(size_t i = 0; i < _shards.size(); ++i)
+    {
+        IceUtil::Mutex::Lock sync(_shards[i].mutex);
+        for(map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::const_iterator p =
+                _shards[i].adapterEndpointsMap.begin(); p != _shards[i].adapterEndpointsMap.end(); ++p)
+        {
+            vector<string>& endpoints = adapters[p->first];
+            for(vector<EndpointIPtr>::const_iterator q = p->second.second.begin(); q != p->second.second.end(); ++q)
+            {
+                endpoints.push_back((*q)->toString());
+            }
+        }
+        for(map<Identity, pair<IceUtil::Time, ReferencePtr> >::const_iterator p = _shards[i].objectMap.begin();
+            p != _shards[i].objectMap.end(); ++p)
+        {
+            objects.insert(make_pair(p->first, p->second.second->toString()));
+        }
+    }
+    out->write(adapters);
+    out->write(objects);
+}
+
+IceInternal::LocatorTable::Shard&
+IceInternal::LocatorTable::shard(const string& adapter) const
+{
+    Int h = 5381;
+    hashAdd(h, adapter);
+    return _shards.get(h);
+}
+
+IceInternal::LocatorTable::Shard&
+IceInternal::LocatorTable::shard(const Identity& id) const
+{
+    Int h = 5381;
+    hashAdd(h, id.name);
+    hashAdd(h, id.category);
+    return _shards.get(h);
+}
+
+bool
+IceInternal::LocatorTable::checkTTL(const IceUtil::Time& time, int ttl, bool& refresh) const
 {
     assert(ttl != 0);
     if (ttl < 0) // TTL = infinite
@@ -341,10 +643,67 @@ IceInternal::LocatorTable::checkTTL(const IceUtil::Time& time, int ttl) const
     }
     else
     {
-        return IceUtil::Time::now(IceUtil::Time::Monotonic) - time <= IceUtil::Time::seconds(ttl);
+        IceUtil::Time age = IceUtil::Time::now(IceUtil::Time::Monotonic) - time;
+        if(age > IceUtil::Time::seconds(ttl))
+        {
+            return false;
+        }
+
+        //
+        // Past the refresh threshold (a percentage of the TTL), the
+        // entry is still valid but it's refreshed in the background.
+        //
+        refresh = _refreshThreshold > 0 &&
+            age > IceUtil::Time::milliSeconds(static_cast<IceUtil::Int64>(ttl) * 10 * _refreshThreshold);
+        return true;
     }
 }
 
+template<typename K> bool
+IceInternal::LocatorTable::checkNotRegistered(map<K, NotRegistered>& notRegisteredMap, const K& key) const
+{
+    typename map<K, NotRegistered>::iterator p = notRegisteredMap.find(key);
+    if(p == notRegisteredMap.end())
+    {
+        return false;
+    }
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    if(now < p->second.expiration)
+    {
+        return true;
+    }
+    else if(now > p->second.expiration + _notRegisteredTimeout * 8)
+    {
+        //
+        // The entry expired a long time ago, forget the previous
+        // failures.
+        //
+        notRegisteredMap.erase(p);
+    }
+    return false;
+}
+
+template<typename K> void
+IceInternal::LocatorTable::addNotRegistered(map<K, NotRegistered>& notRegisteredMap, const K& key) const
+{
+    typename map<K, NotRegistered>::iterator p = notRegisteredMap.find(key);
+    if(p == notRegisteredMap.end())
+    {
+        NotRegistered notRegistered;
+        notRegistered.failures = 0;
+        p = notRegisteredMap.insert(make_pair(key, notRegistered)).first;
+    }
+
+    //
+    // Back off: the timeout doubles with each consecutive failure, up
+    // to 8 times the configured timeout.
+    //
+    p->second.expiration = IceUtil::Time::now(IceUtil::Time::Monotonic) +
+        _notRegisteredTimeout * (1 << min(p->second.failures, 3));
+    ++p->second.failures;
+}
+
 void
 IceInternal::LocatorInfo::RequestCallback::response(const LocatorInfoPtr& locatorInfo, const Ice::ObjectPrxPtr& proxy)
 {
@@ -561,9 +920,24 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
     vector<EndpointIPtr> endpoints;
     if(!ref->isWellKnown())
     {
-        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints))
+        bool refresh = false;
+        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints, refresh))
         {
-            if(_background && !endpoints.empty())
+            if(_table->isAdapterNotRegistered(ref->getAdapterId(), ttl))
+            {
+                //
+                // The adapter wasn't found by a recent lookup, fail
+                // without contacting the locator again.
+                //
+                if(wellKnownRef)
+                {
+                    _table->removeObjectReference(wellKnownRef->getIdentity());
+                }
+                RequestCallbackPtr cb = new RequestCallback(ref, ttl, callback);
+                cb->exception(this, AdapterNotFoundException());
+                return;
+            }
+            else if(_background && !endpoints.empty())
             {
                 getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, 0);
             }
@@ -573,13 +947,32 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
                 return;
             }
         }
+        else if(refresh)
+        {
+            //
+            // The cached endpoints are about to expire, refresh them
+            // in the background.
+            //
+            getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, 0);
+        }
     }
     else
     {
         ReferencePtr r;
-        if(!_table->getObjectReference(ref->getIdentity(), ttl, r))
+        bool refresh = false;
+        if(!_table->getObjectReference(ref->getIdentity(), ttl, r, refresh))
         {
-            if(_background && r)
+            if(_table->isObjectNotRegistered(ref->getIdentity(), ttl))
+            {
+                //
+                // The object wasn't found by a recent lookup, fail
+                // without contacting the locator again.
+                //
+                RequestCallbackPtr cb = new RequestCallback(ref, ttl, callback);
+                cb->exception(this, ObjectNotFoundException());
+                return;
+            }
+            else if(_background && r)
             {
                 getObjectRequest(ref)->addCallback(ref, 0, ttl, 0);
             }
@@ -589,6 +982,14 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
                 return;
             }
         }
+        else if(refresh)
+        {
+            //
+            // The cached reference is about to expire, refresh it in
+            // the background.
+            //
+            getObjectRequest(ref)->addCallback(ref, 0, ttl, 0);
+        }
 
         if(!r->isIndirect())
         {
@@ -862,6 +1263,7 @@ IceInternal::LocatorInfo::finishRequest(const ReferencePtr& ref,
         else if(notRegistered) // If the adapter isn't registered anymore, remove it from the cache.
         {
             _table->removeAdapterEndpoints(ref->getAdapterId());
+            _table->addAdapterNotRegistered(ref->getAdapterId());
         }
 
         IceUtil::Mutex::Lock sync(*this);
@@ -877,6 +1279,7 @@ IceInternal::LocatorInfo::finishRequest(const ReferencePtr& ref,
         else if(notRegistered) // If the well-known object isn't registered anymore, remove it from the cache.
         {
             _table->removeObjectReference(ref->getIdentity());
+            _table->addObjectNotRegistered(ref->getIdentity());
         }
 
         IceUtil::Mutex::Lock sync(*this);
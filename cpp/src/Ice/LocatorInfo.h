@@ -15,6 +15,7 @@
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Time.h>
 #include <Ice/LocatorInfoF.h>
+#include <Ice/InstanceF.h>
 #include <Ice/LocatorF.h>
 #include <Ice/ReferenceF.h>
 #include <Ice/Identity.h>
@@ -23,6 +24,15 @@
 #include <Ice/Version.h>
 
 #include <Ice/UniquePtr.h>
+#include <Ice/Shards.h>
+
+namespace Ice
+{
+
+class InputStream;
+class OutputStream;
+
+}
 
 namespace IceInternal
 {
@@ -31,7 +41,7 @@ class LocatorManager : public IceUtil::Shared, public IceUtil::Mutex
 {
 public:
 
-    LocatorManager(const Ice::PropertiesPtr&);
+    LocatorManager(const InstancePtr&);
 
     void destroy();
 
@@ -43,7 +53,16 @@ public:
 
 private:
 
+    LocatorTablePtr getLocatorTable(const std::pair<Ice::Identity, Ice::EncodingVersion>&);
+    void loadCache();
+    void saveCache();
+
+    InstancePtr _instance;
     const bool _background;
+    const int _refreshThreshold;
+    const int _notRegisteredTimeout;
+    const std::string _cacheFile;
+    bool _cacheLoaded;
 
 #ifdef ICE_CPP11_MAPPING
     using LocatorInfoTable = std::map<std::shared_ptr<Ice::LocatorPrx>,
@@ -58,28 +77,71 @@ private:
     std::map<std::pair<Ice::Identity, Ice::EncodingVersion>, LocatorTablePtr> _locatorTables;
 };
 
-class LocatorTable : public IceUtil::Shared, public IceUtil::Mutex
+//
+// The cache of adapter endpoints and well-known object references
+// shared by the locator infos of a locator. Every indirect proxy
+// invocation that isn't bound to a connection checks this cache, the
+// entries are sharded by adapter id or identity.
+//
+class LocatorTable : public IceUtil::Shared
 {
 public:
 
-    LocatorTable();
+    LocatorTable(int, int);
 
     void clear();
 
-    bool getAdapterEndpoints(const std::string&, int, ::std::vector<EndpointIPtr>&);
+    bool getAdapterEndpoints(const std::string&, int, ::std::vector<EndpointIPtr>&, bool&);
     void addAdapterEndpoints(const std::string&, const ::std::vector<EndpointIPtr>&);
     ::std::vector<EndpointIPtr> removeAdapterEndpoints(const std::string&);
 
-    bool getObjectReference(const Ice::Identity&, int, ReferencePtr&);
+    bool getObjectReference(const Ice::Identity&, int, ReferencePtr&, bool&);
     void addObjectReference(const Ice::Identity&, const ReferencePtr&);
     ReferencePtr removeObjectReference(const Ice::Identity&);
 
+    bool isAdapterNotRegistered(const std::string&, int);
+    void addAdapterNotRegistered(const std::string&);
+
+    bool isObjectNotRegistered(const Ice::Identity&, int);
+    void addObjectNotRegistered(const Ice::Identity&);
+
+    void load(Ice::InputStream*, const InstancePtr&);
+    void save(Ice::OutputStream*) const;
+
 private:
 
-    bool checkTTL(const IceUtil::Time&, int) const;
+    //
+    // A failed lookup: the adapter or object isn't looked up again
+    // until the expiration time. The timeout doubles with each
+    // consecutive failure.
+    //
+    struct NotRegistered
+    {
+        IceUtil::Time expiration;
+        int failures;
+    };
+
+    struct Shard
+    {
+        IceUtil::Mutex mutex;
+        std::map<std::string, std::pair<IceUtil::Time, std::vector<EndpointIPtr> > > adapterEndpointsMap;
+        std::map<Ice::Identity, std::pair<IceUtil::Time, ReferencePtr> > objectMap;
+        std::map<std::string, NotRegistered> adapterNotRegisteredMap;
+        std::map<Ice::Identity, NotRegistered> objectNotRegisteredMap;
+    };
+
+    Shard& shard(const std::string&) const;
+    Shard& shard(const Ice::Identity&) const;
+
+    bool checkTTL(const IceUtil::Time&, int, bool&) const;
+
+    template<typename K> bool checkNotRegistered(std::map<K, NotRegistered>&, const K&) const;
+    template<typename K> void addNotRegistered(std::map<K, NotRegistered>&, const K&) const;
+
+    const int _refreshThreshold;
+    const IceUtil::Time _notRegisteredTimeout;
 
-    std::map<std::string, std::pair<IceUtil::Time, std::vector<EndpointIPtr> > > _adapterEndpointsMap;
-    std::map<Ice::Identity, std::pair<IceUtil::Time, ReferencePtr> > _objectMap;
+    Shards<Shard> _shards;
 };
 
 class LocatorInfo : public IceUtil::Shared, public IceUtil::Mutex
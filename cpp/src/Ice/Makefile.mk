@@ -19,6 +19,12 @@ endif
 
 Ice_sliceflags          := --include-dir Ice
 Ice_libs                := bz2
+
+ifeq ($(WS_DEFLATE),yes)
+    Ice_cppflags        += -DICE_HAS_ZLIB
+    Ice_libs            += zlib
+endif
+
 Ice_extra_sources       := $(wildcard src/IceUtil/*.cpp)
 Ice_excludes            = src/Ice/DLLMain.cpp
 
@@ -124,28 +124,6 @@ struct RandomNumberGenerator : public std::unary_function<ptrdiff_t, ptrdiff_t>
     }
 };
 
-void
-sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType, bool preferIPv6)
-{
-    if(selType == Ice::ICE_ENUM(EndpointSelectionType, Random))
-    {
-        RandomNumberGenerator rng;
-        random_shuffle(addrs.begin(), addrs.end(), rng);
-    }
-
-    if(protocol == EnableBoth)
-    {
-        if(preferIPv6)
-        {
-            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
-        }
-        else
-        {
-            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
-        }
-    }
-}
-
 void
 setTcpNoDelay(SOCKET fd)
 {
@@ -1050,6 +1028,29 @@ IceInternal::getAddresses(const string& host, int port, ProtocolSupport, Ice::En
 
 }
 #else
+void
+IceInternal::sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType,
+                           bool preferIPv6)
+{
+    if(selType == Ice::ICE_ENUM(EndpointSelectionType, Random))
+    {
+        RandomNumberGenerator rng;
+        random_shuffle(addrs.begin(), addrs.end(), rng);
+    }
+
+    if(protocol == EnableBoth)
+    {
+        if(preferIPv6)
+        {
+            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
+        }
+        else
+        {
+            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
+        }
+    }
+}
+
 vector<Address>
 IceInternal::getAddresses(const string& host, int port, ProtocolSupport protocol, Ice::EndpointSelectionType selType,
                           bool preferIPv6, bool canBlock)
@@ -2189,6 +2190,61 @@ IceInternal::setReuseAddress(SOCKET fd, bool reuse)
 }
 #endif
 
+#if defined(ICE_OS_UWP) || !defined(SO_REUSEPORT)
+void
+IceInternal::setReusePort(SOCKET fd, bool reuse)
+{
+    if(reuse)
+    {
+        closeSocketNoThrow(fd);
+        throw FeatureNotSupportedException(__FILE__, __LINE__, "SO_REUSEPORT");
+    }
+}
+#else
+void
+IceInternal::setReusePort(SOCKET fd, bool reuse)
+{
+    int flag = reuse ? 1 : 0;
+    if(setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<char*>(&flag), int(sizeof(int))) == SOCKET_ERROR)
+    {
+        closeSocketNoThrow(fd);
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+}
+#endif
+
+//
+// TCP Fast Open is a best-effort optimization: the options are silently
+// ignored if the platform or the kernel configuration doesn't support them.
+//
+#if defined(ICE_OS_UWP) || !defined(TCP_FASTOPEN)
+void
+IceInternal::setTcpFastOpen(SOCKET, int)
+{
+}
+#else
+void
+IceInternal::setTcpFastOpen(SOCKET fd, int queueLength)
+{
+    setsockopt(fd, IPPROTO_TCP, TCP_FASTOPEN, reinterpret_cast<char*>(&queueLength), int(sizeof(int)));
+}
+#endif
+
+#if defined(ICE_OS_UWP) || !defined(TCP_FASTOPEN_CONNECT)
+bool
+IceInternal::setTcpFastOpenConnect(SOCKET)
+{
+    return false;
+}
+#else
+bool
+IceInternal::setTcpFastOpenConnect(SOCKET fd)
+{
+    int flag = 1;
+    return setsockopt(fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, reinterpret_cast<char*>(&flag), int(sizeof(int))) == 0;
+}
+#endif
+
 #ifdef ICE_OS_UWP
 namespace
 {
@@ -2665,6 +2721,36 @@ repeatAccept:
     return ret;
 }
 
+SOCKET
+IceInternal::doTryAccept(SOCKET fd)
+{
+#ifdef _WIN32
+    SOCKET ret;
+#else
+    int ret;
+#endif
+
+repeatAccept:
+    if((ret = ::accept(fd, 0, 0)) == INVALID_SOCKET)
+    {
+        if(acceptInterrupted())
+        {
+            goto repeatAccept;
+        }
+
+        if(wouldBlock())
+        {
+            return INVALID_SOCKET;
+        }
+
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+
+    setTcpNoDelay(ret);
+    setKeepAlive(ret);
+    return ret;
+}
+
 void
 IceInternal::createPipe(SOCKET fds[2])
 {
@@ -69,6 +69,25 @@ inline EndpointIPtr toEndpointI(const EndpointPtr& endp)
     return ICE_DYNAMIC_CAST(EndpointI, endp);
 }
 
+inline bool isReusePortEndpoint(const EndpointIPtr& endp)
+{
+    Short type = endp->type();
+    return type == TCPEndpointType || type == SSLEndpointType || type == WSEndpointType || type == WSSEndpointType;
+}
+
+template<typename T, typename U>
+inline bool containsEndpoint(const vector<T>& endpoints, const U& endp)
+{
+    for(typename vector<T>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    {
+        if(targetEqualTo(*p, endp))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 }
 
 string
@@ -652,17 +671,20 @@ Ice::ObjectAdapterI::getEndpoints() const
 {
     IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
 
+    //
+    // Skip the duplicate endpoints of the additional listening sockets
+    // opened with <adapter>.Acceptors.
+    //
     EndpointSeq endpoints;
-    transform(_incomingConnectionFactories.begin(), _incomingConnectionFactories.end(),
-            back_inserter(endpoints),
-#ifdef ICE_CPP11_MAPPING
-            [](const IncomingConnectionFactoryPtr& factory)
-            {
-                return factory->endpoint();
-            });
-#else
-            Ice::constMemFun(&IncomingConnectionFactory::endpoint));
-#endif
+    for(vector<IncomingConnectionFactoryPtr>::const_iterator p = _incomingConnectionFactories.begin();
+        p != _incomingConnectionFactories.end(); ++p)
+    {
+        EndpointIPtr endpoint = (*p)->endpoint();
+        if(!containsEndpoint(endpoints, endpoint))
+        {
+            endpoints.push_back(endpoint);
+        }
+    }
     return endpoints;
 }
 
@@ -1097,6 +1119,7 @@ Ice::ObjectAdapterI::initialize(const RouterPrxPtr& router)
             // fill in the real port number.
             //
             vector<EndpointIPtr> endpoints = parseEndpoints(properties->getProperty(_name + ".Endpoints"), true);
+            const int acceptors = properties->getPropertyAsIntWithDefault(_name + ".Acceptors", 1);
             for(vector<EndpointIPtr>::iterator p = endpoints.begin(); p != endpoints.end(); ++p)
             {
                 EndpointIPtr publishedEndpoint;
@@ -1110,6 +1133,26 @@ Ice::ObjectAdapterI::initialize(const RouterPrxPtr& router)
                                                                            ICE_SHARED_FROM_THIS);
                     factory->initialize();
                     _incomingConnectionFactories.push_back(factory);
+
+                    //
+                    // Open the additional listening sockets of TCP based
+                    // endpoints. They are bound to the effective address of
+                    // the first socket with SO_REUSEPORT, and the kernel
+                    // spreads the new connections across them.
+                    //
+                    if(acceptors > 1 && isReusePortEndpoint(factory->endpoint()))
+                    {
+                        for(int i = 1; i < acceptors; ++i)
+                        {
+                            IncomingConnectionFactoryPtr f = ICE_MAKE_SHARED(IncomingConnectionFactory,
+                                                                             _instance,
+                                                                             factory->endpoint(),
+                                                                             publishedEndpoint,
+                                                                             ICE_SHARED_FROM_THIS);
+                            f->initialize();
+                            _incomingConnectionFactories.push_back(f);
+                        }
+                    }
                 }
             }
             if(endpoints.empty())
@@ -1333,7 +1376,7 @@ ObjectAdapterI::parsePublishedEndpoints()
                 // expands to multiple addresses. In this case, multiple incoming connection
                 // factories can point to the same published endpoint.
                 //
-                if(::find(endpoints.begin(), endpoints.end(), *p) == endpoints.end())
+                if(!containsEndpoint(endpoints, *p))
                 {
                     endpoints.push_back(*p);
                 }
@@ -1459,6 +1502,7 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ACM.Close",
         "ACM.Heartbeat",
         "ACM.Timeout",
+        "Acceptors",
         "AdapterId",
         "Endpoints",
         "Locator",
@@ -20,6 +20,7 @@
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/BufferCache.h>
 
 using namespace std;
 using namespace Ice;
@@ -270,6 +271,7 @@ OutgoingAsyncBase::OutgoingAsyncBase(const InstancePtr& instance) :
     _instance(instance),
     _sentSynchronously(false),
     _doneInSent(false),
+    _priority(false),
     _state(0),
     _os(instance.get(), Ice::currentProtocolEncoding),
     _is(instance.get(), Ice::currentProtocolEncoding)
@@ -858,6 +860,21 @@ OutgoingAsync::OutgoingAsync(const ObjectPrxPtr& prx, bool synchronous) :
 {
 }
 
+OutgoingAsync::~OutgoingAsync()
+{
+    //
+    // Give the request and reply buffers back to this thread's buffer
+    // cache. The request buffer is empty if it was adopted by the
+    // connection and the reply buffer is the connection read buffer
+    // that received the reply.
+    //
+    if(_instance->cacheMessageBuffers())
+    {
+        BufferCache::release(_os.b);
+        BufferCache::release(_is.b);
+    }
+}
+
 void
 OutgoingAsync::prepare(const string& operation, OperationMode mode, const Context& context)
 {
@@ -869,9 +886,28 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
     switch(_proxy->_getReference()->getMode())
     {
         case Reference::ModeTwoway:
+        {
+            if(_instance->cacheMessageBuffers())
+            {
+                //
+                // The reply buffer is swapped with the connection read
+                // buffer when the reply is received, providing it with
+                // cached memory saves the connection an allocation.
+                //
+                BufferCache::acquire(_os.b);
+                BufferCache::acquire(_is.b);
+            }
+            _os.writeBlob(requestHdr, sizeof(requestHdr));
+            break;
+        }
+
         case Reference::ModeOneway:
         case Reference::ModeDatagram:
         {
+            if(_instance->cacheMessageBuffers())
+            {
+                BufferCache::acquire(_os.b);
+            }
             _os.writeBlob(requestHdr, sizeof(requestHdr));
             break;
         }
@@ -897,7 +933,7 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
     }
     else
     {
-        string facet = ref->getFacet();
+        const string& facet = ref->getFacet();
         _os.write(&facet, &facet + 1);
     }
 
@@ -921,6 +957,7 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         // Explicit context
         //
         _os.write(context);
+        _priority = !context.empty() && context.find(priorityContextKey) != context.end();
     }
     else
     {
@@ -929,6 +966,7 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         //
         const ImplicitContextIPtr& implicitContext = ref->getInstance()->getImplicitContext();
         const Context& prxContext = ref->getContext()->getValue();
+        _priority = !prxContext.empty() && prxContext.find(priorityContextKey) != prxContext.end();
         if(implicitContext == 0)
         {
             _os.write(prxContext);
@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue May 16 17:04:55 2017
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Mon Oct 19 07:21:20 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -32,6 +32,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ACM.Heartbeat", false, 0),
     IceInternal::Property("Ice.Admin.ACM.Close", false, 0),
     IceInternal::Property("Ice.Admin.ACM", false, 0),
+    IceInternal::Property("Ice.Admin.Acceptors", false, 0),
     IceInternal::Property("Ice.Admin.AdapterId", false, 0),
     IceInternal::Property("Ice.Admin.Endpoints", false, 0),
     IceInternal::Property("Ice.Admin.Locator.EndpointSelection", false, 0),
@@ -64,6 +65,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Enabled", false, 0),
@@ -84,6 +86,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Config", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Default.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
     IceInternal::Property("Ice.Default.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Host", false, 0),
@@ -119,10 +122,15 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
     IceInternal::Property("Ice.HTTPProxyPort", false, 0),
+    IceInternal::Property("Ice.HostResolver.CacheTimeout", false, 0),
+    IceInternal::Property("Ice.HostResolver.SizeMax", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
     IceInternal::Property("Ice.InitPlugins", false, 0),
     IceInternal::Property("Ice.IPv4", false, 0),
     IceInternal::Property("Ice.IPv6", false, 0),
+    IceInternal::Property("Ice.LocatorCacheFile", false, 0),
+    IceInternal::Property("Ice.LocatorCacheNotRegisteredTimeout", false, 0),
+    IceInternal::Property("Ice.LocatorCacheRefreshThreshold", false, 0),
     IceInternal::Property("Ice.LogFile", false, 0),
     IceInternal::Property("Ice.LogFile.SizeMax", false, 0),
     IceInternal::Property("Ice.LogStdErr.Convert", false, 0),
@@ -157,6 +165,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.BusyPoll", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
@@ -164,6 +173,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Server.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.BusyPoll", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
     IceInternal::Property("Ice.ToStringMode", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
@@ -174,9 +184,12 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Trace.Retry", false, 0),
     IceInternal::Property("Ice.Trace.Slicing", false, 0),
     IceInternal::Property("Ice.Trace.ThreadPool", false, 0),
+    IceInternal::Property("Ice.UDP.RcvBatchSize", false, 0),
     IceInternal::Property("Ice.UDP.RcvSize", false, 0),
+    IceInternal::Property("Ice.UDP.SndBatchSize", false, 0),
     IceInternal::Property("Ice.UDP.SndSize", false, 0),
     IceInternal::Property("Ice.TCP.Backlog", false, 0),
+    IceInternal::Property("Ice.TCP.FastOpen", false, 0),
     IceInternal::Property("Ice.TCP.RcvSize", false, 0),
     IceInternal::Property("Ice.TCP.SndSize", false, 0),
     IceInternal::Property("Ice.UseApplicationClassLoader", false, 0),
@@ -217,6 +230,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ACM", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Acceptors", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.AdapterId", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.EndpointSelection", false, 0),
@@ -249,11 +263,13 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Acceptors", false, 0),
     IceInternal::Property("IceDiscovery.Reply.AdapterId", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.EndpointSelection", false, 0),
@@ -286,11 +302,13 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Acceptors", false, 0),
     IceInternal::Property("IceDiscovery.Locator.AdapterId", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.EndpointSelection", false, 0),
@@ -323,6 +341,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Lookup", false, 0),
     IceInternal::Property("IceDiscovery.Timeout", false, 0),
@@ -344,6 +363,7 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ACM", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Acceptors", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.AdapterId", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.EndpointSelection", false, 0),
@@ -376,11 +396,13 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.MessageSizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Acceptors", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.AdapterId", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.EndpointSelection", false, 0),
@@ -413,6 +435,7 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.MessageSizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Lookup", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Timeout", false, 0),
@@ -477,6 +500,7 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceBridge.Source.ACM.Close", false, 0),
     IceInternal::Property("IceBridge.Source.ACM", false, 0),
+    IceInternal::Property("IceBridge.Source.Acceptors", false, 0),
     IceInternal::Property("IceBridge.Source.AdapterId", false, 0),
     IceInternal::Property("IceBridge.Source.Endpoints", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.EndpointSelection", false, 0),
@@ -509,6 +533,7 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceBridge.Source.MessageSizeMax", false, 0),
     IceInternal::Property("IceBridge.Target.Endpoints", false, 0),
     IceInternal::Property("IceBridge.InstanceName", false, 0),
@@ -535,6 +560,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Acceptors", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.AdapterId", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.EndpointSelection", false, 0),
@@ -567,11 +593,13 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Acceptors", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.AdapterId", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.EndpointSelection", false, 0),
@@ -604,6 +632,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.MessageSizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.Observers", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.SaveToRegistry", false, 0),
@@ -619,6 +648,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ACM", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Acceptors", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.AdapterId", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Endpoints", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.EndpointSelection", false, 0),
@@ -651,12 +681,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Node.ACM", false, 0),
+    IceInternal::Property("IceGrid.Node.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Node.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Node.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.EndpointSelection", false, 0),
@@ -689,12 +721,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
     IceInternal::Property("IceGrid.Node.Data", false, 0),
     IceInternal::Property("IceGrid.Node.DisableOnFailure", false, 0),
+    IceInternal::Property("IceGrid.Node.DispatchLoadPeriod", false, 0),
     IceInternal::Property("IceGrid.Node.Name", false, 0),
     IceInternal::Property("IceGrid.Node.Output", false, 0),
     IceInternal::Property("IceGrid.Node.ProcessorSocketCount", false, 0),
@@ -735,6 +769,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.EndpointSelection", false, 0),
@@ -767,6 +802,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
@@ -782,6 +818,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.EndpointSelection", false, 0),
@@ -814,6 +851,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
@@ -821,6 +859,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.EndpointSelection", false, 0),
@@ -853,6 +892,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Enabled", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Address", false, 0),
@@ -863,6 +903,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.EndpointSelection", false, 0),
@@ -895,7 +936,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.LMDB.GroupCommitMaxLatency", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.MapSize", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.Path", false, 0),
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
@@ -911,12 +954,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier", false, 0),
     IceInternal::Property("IceGrid.Registry.ReplicaName", false, 0),
     IceInternal::Property("IceGrid.Registry.ReplicaSessionTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.ReplicationLogSize", false, 0),
     IceInternal::Property("IceGrid.Registry.RequireNodeCertCN", false, 0),
     IceInternal::Property("IceGrid.Registry.RequireReplicaCertCN", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.EndpointSelection", false, 0),
@@ -949,12 +994,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Acceptors", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.AdapterId", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.EndpointSelection", false, 0),
@@ -987,6 +1034,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
@@ -1025,6 +1073,7 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ACM.Heartbeat", false, 0),
     IceInternal::Property("IcePatch2.ACM.Close", false, 0),
     IceInternal::Property("IcePatch2.ACM", false, 0),
+    IceInternal::Property("IcePatch2.Acceptors", false, 0),
     IceInternal::Property("IcePatch2.AdapterId", false, 0),
     IceInternal::Property("IcePatch2.Endpoints", false, 0),
     IceInternal::Property("IcePatch2.Locator.EndpointSelection", false, 0),
@@ -1057,6 +1106,7 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
@@ -1099,6 +1149,7 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.FindCert", false, 0),
     IceInternal::Property("IceSSL.FindCert.*", true, 0),
     IceInternal::Property("IceSSL.InitOpenSSL", false, 0),
+    IceInternal::Property("IceSSL.KernelTLS", false, 0),
     IceInternal::Property("IceSSL.KeyFile", true, 0),
     IceInternal::Property("IceSSL.Keychain", false, 0),
     IceInternal::Property("IceSSL.KeychainPassword", false, 0),
@@ -1158,6 +1209,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ACM.Heartbeat", false, 0),
     IceInternal::Property("Glacier2.Client.ACM.Close", false, 0),
     IceInternal::Property("Glacier2.Client.ACM", false, 0),
+    IceInternal::Property("Glacier2.Client.Acceptors", false, 0),
     IceInternal::Property("Glacier2.Client.AdapterId", false, 0),
     IceInternal::Property("Glacier2.Client.Endpoints", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.EndpointSelection", false, 0),
@@ -1190,6 +1242,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
@@ -1233,6 +1286,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ACM.Heartbeat", false, 0),
     IceInternal::Property("Glacier2.Server.ACM.Close", false, 0),
     IceInternal::Property("Glacier2.Server.ACM", false, 0),
+    IceInternal::Property("Glacier2.Server.Acceptors", false, 0),
     IceInternal::Property("Glacier2.Server.AdapterId", false, 0),
     IceInternal::Property("Glacier2.Server.Endpoints", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.EndpointSelection", false, 0),
@@ -1265,6 +1319,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.BusyPoll", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue May 16 17:04:55 2017
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Mon Oct 19 07:21:20 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
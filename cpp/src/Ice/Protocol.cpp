@@ -62,6 +62,8 @@ const Ice::Byte replyHdr[] =
     0, 0, 0, 0 // Message size (placeholder)
 };
 
+const std::string priorityContextKey = "_priority";
+
 void
 stringToMajorMinor(const std::string& str, Ice::Byte& major, Ice::Byte& minor)
 {
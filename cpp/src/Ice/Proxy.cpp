@@ -739,6 +739,15 @@ ICE_OBJECT_PRX::ice_identity(const Identity& newIdentity) const
         ObjectPrxPtr proxy = new IceProxy::Ice::Object;
 #endif
         proxy->setup(_reference->changeIdentity(newIdentity));
+        if(!_reference->isWellKnown())
+        {
+            //
+            // The identity of a well-known proxy is used to locate its
+            // endpoints, for other proxies it doesn't affect the choice
+            // of the connection.
+            //
+            _shareRequestHandler(proxy);
+        }
         return proxy;
     }
 }
@@ -754,6 +763,7 @@ ICE_OBJECT_PRX::ice_context(const Context& newContext) const
 {
     ObjectPrxPtr proxy = _newInstance();
     proxy->setup(_reference->changeContext(newContext));
+    _shareRequestHandler(proxy);
     return proxy;
 }
 
@@ -778,6 +788,7 @@ ICE_OBJECT_PRX::ice_facet(const string& newFacet) const
         ObjectPrx proxy = new IceProxy::Ice::Object;
 #endif
         proxy->setup(_reference->changeFacet(newFacet));
+        _shareRequestHandler(proxy);
         return proxy;
     }
 }
@@ -1269,6 +1280,52 @@ ICE_OBJECT_PRX::ice_getCachedConnection() const
     return 0;
 }
 
+void
+ICE_OBJECT_PRX::ice_prewarmConnections()
+{
+    //
+    // Establish and validate in the background a connection to each of
+    // the proxy endpoints. The connections are cached by the outgoing
+    // connection factory and reused by proxies which fail over to these
+    // endpoints. This proxy also binds in the background to one of them.
+    // Failures are ignored, they will be reported to the invocations
+    // which need the connection.
+    //
+    EndpointSeq endpoints = ice_getEndpoints();
+    vector<ObjectPrxPtr> proxies;
+    proxies.push_back(ICE_SHARED_FROM_THIS);
+    if(endpoints.size() > 1)
+    {
+        for(EndpointSeq::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+        {
+            proxies.push_back(ice_endpoints(EndpointSeq(1, *p)));
+        }
+    }
+
+    for(vector<ObjectPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+    {
+#ifdef ICE_CPP11_MAPPING
+        try
+        {
+            //
+            // Unlike begin_ice_getConnection, this raises the failures to
+            // establish the connection detected by the calling thread.
+            //
+            (*p)->ice_getConnectionAsync([](shared_ptr<Connection>) {}, [](exception_ptr) {});
+        }
+        catch(const CommunicatorDestroyedException&)
+        {
+            throw;
+        }
+        catch(const LocalException&)
+        {
+        }
+#else
+        (*p)->begin_ice_getConnection();
+#endif
+    }
+}
+
 void
 ICE_OBJECT_PRX::setup(const ReferencePtr& ref)
 {
@@ -1402,6 +1459,25 @@ ICE_OBJECT_PRX::_copyFrom(const ObjectPrxPtr& from)
     _requestHandler = from->_requestHandler;
 }
 
+void
+ICE_OBJECT_PRX::_shareRequestHandler(const ObjectPrxPtr& proxy) const
+{
+    //
+    // The given proxy was just created from this proxy by changing an
+    // attribute that doesn't affect connection establishment (such as
+    // the facet or the context). Give it this proxy's request handler
+    // so that its first invocation doesn't go through the request
+    // handler factory and the connection lookup again.
+    //
+    if(!_reference->getCacheConnection())
+    {
+        return;
+    }
+
+    IceUtil::Mutex::Lock sync(_mutex);
+    proxy->_requestHandler = _requestHandler;
+}
+
 CommunicatorPtr
 ICE_OBJECT_PRX::ice_getCommunicator() const
 {
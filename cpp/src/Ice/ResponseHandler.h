@@ -37,7 +37,7 @@ class ResponseHandler :
 {
 public:
 
-    virtual void sendResponse(Ice::Int, Ice::OutputStream*, Ice::Byte, bool) = 0;
+    virtual void sendResponse(Ice::Int, Ice::OutputStream*, Ice::Byte, bool, bool) = 0;
     virtual void sendNoResponse() = 0;
     virtual bool systemException(Ice::Int, const Ice::SystemException&, bool) = 0;
     virtual void invokeException(Ice::Int, const Ice::LocalException&, int, bool) = 0;
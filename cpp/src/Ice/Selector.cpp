@@ -234,7 +234,11 @@ Selector::completed(EventHandler* handler, SocketOperation op)
 
 #elif defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL) || defined(ICE_USE_SELECT) || defined(ICE_USE_POLL)
 
-Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrupted(false)
+Selector::Selector(const InstancePtr& instance) :
+    _instance(instance),
+    _interrupted(false),
+    _busyPollCount(0),
+    _busyPollHits(0)
 {
     SOCKET fds[2];
     createPipe(fds);
@@ -697,6 +701,22 @@ Selector::select(int timeout)
         timeout = -1;
     }
 
+    //
+    // With busy polling, the selector first polls without blocking until
+    // events are ready or the busy poll time elapsed. This avoids paying
+    // the scheduler wake-up latency when the events arrive shortly.
+    //
+    IceUtil::Time busyPollStart;
+    IceUtil::Time busyPollEnd;
+    const int blockingTimeout = timeout;
+    if(_busyPoll > IceUtil::Time() && timeout != 0)
+    {
+        busyPollStart = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        busyPollEnd = busyPollStart + _busyPoll;
+        timeout = 0;
+        ++_busyPollCount;
+    }
+
     int spuriousWakeup = 0;
     while(true)
     {
@@ -746,6 +766,21 @@ Selector::select(int timeout)
             out << "selector failed:\n" << ex;
             IceUtil::ThreadControl::sleep(IceUtil::Time::seconds(5)); // Sleep 5s to avoid looping
         }
+        else if(_count == 0 && busyPollEnd != IceUtil::Time())
+        {
+            IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            if(now >= busyPollEnd)
+            {
+                //
+                // Nothing ready while busy polling, block with the
+                // selector timeout.
+                //
+                _busyPollTime += now - busyPollStart;
+                busyPollEnd = IceUtil::Time();
+                timeout = blockingTimeout;
+            }
+            continue;
+        }
         else if(_count == 0 && timeout < 0)
         {
             if(++spuriousWakeup > 100)
@@ -759,12 +794,27 @@ Selector::select(int timeout)
         break;
     }
 
+    if(busyPollEnd != IceUtil::Time())
+    {
+        _busyPollTime += IceUtil::Time::now(IceUtil::Time::Monotonic) - busyPollStart;
+        if(_count > 0)
+        {
+            ++_busyPollHits;
+        }
+    }
+
     if(_count == 0 && !_selectNow)
     {
         throw SelectorTimeoutException();
     }
 }
 
+void
+Selector::setBusyPoll(int busyPoll)
+{
+    _busyPoll = IceUtil::Time::microSeconds(busyPoll);
+}
+
 void
 Selector::checkReady(EventHandler* handler)
 {
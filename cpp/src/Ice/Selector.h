@@ -13,6 +13,7 @@
 #include <IceUtil/StringUtil.h>
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
 
 #include <Ice/Network.h>
 #include <Ice/InstanceF.h>
@@ -135,6 +136,27 @@ public:
     void finishSelect(std::vector<std::pair<EventHandler*, SocketOperation> >&);
     void select(int);
 
+    void setBusyPoll(int);
+
+    //
+    // The time spent busy polling, the number of selects which busy
+    // polled and how many of them found ready events before blocking.
+    //
+    IceUtil::Time getBusyPollTime() const
+    {
+        return _busyPollTime;
+    }
+
+    size_t getBusyPollCount() const
+    {
+        return _busyPollCount;
+    }
+
+    size_t getBusyPollHits() const
+    {
+        return _busyPollHits;
+    }
+
 private:
 
     void wakeup();
@@ -152,6 +174,11 @@ private:
     bool _selecting;
     std::map<EventHandlerPtr, SocketOperation> _readyHandlers;
 
+    IceUtil::Time _busyPoll;
+    IceUtil::Time _busyPollTime;
+    size_t _busyPollCount;
+    size_t _busyPollHits;
+
 #if defined(ICE_USE_EPOLL)
     std::vector<struct epoll_event> _events;
     int _queueFd;
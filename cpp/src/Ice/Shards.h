@@ -0,0 +1,51 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_SHARDS_H
+#define ICE_SHARDS_H
+
+#include <IceUtil/Config.h>
+#include <Ice/Config.h>
+
+namespace IceInternal
+{
+
+//
+// A fixed number of shards selected by hash. A table split over the
+// shards protects each shard with its own mutex, threads working on
+// entries of different shards don't contend on a single mutex.
+//
+template<typename T, size_t N = 16>
+class Shards : public IceUtil::noncopyable
+{
+public:
+
+    T& get(Ice::Int hash) const
+    {
+        return _shards[static_cast<unsigned int>(hash) % N];
+    }
+
+    T& operator[](size_t i) const
+    {
+        return _shards[i];
+    }
+
+    size_t size() const
+    {
+        return N;
+    }
+
+private:
+
+    mutable T _shards[N];
+};
+
+}
+
+#endif
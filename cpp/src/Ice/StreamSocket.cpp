@@ -10,12 +10,16 @@
 #include <Ice/StreamSocket.h>
 #include <Ice/NetworkProxy.h>
 #include <Ice/ProtocolInstance.h>
+#include <Ice/Properties.h>
+
+#if !defined(_WIN32)
+#   include <sys/uio.h>
+#endif
 
 using namespace IceInternal;
 
 #if defined(ICE_OS_UWP)
 
-#include <Ice/Properties.h>
 using namespace Platform;
 using namespace Windows::Foundation;
 
@@ -30,16 +34,23 @@ StreamSocket::StreamSocket(const ProtocolInstancePtr& instance,
     _proxy(proxy),
     _addr(addr),
     _sourceAddr(sourceAddr),
-    _state(StateNeedConnect)
+    _state(StateNeedConnect),
+    _fastOpen(false)
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead), _write(SocketOperationWrite)
 #endif
 {
     init();
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    //
+    // With TCP Fast Open, the connect call completes immediately and the
+    // SYN is only sent with the first data written on the socket.
+    //
+    bool fastOpen = _instance->properties()->getPropertyAsInt("Ice.TCP.FastOpen") > 0 && setTcpFastOpenConnect(_fd);
     if(doConnect(_fd, _proxy ? _proxy->getAddress() : _addr, sourceAddr))
     {
         _state = _proxy ? StateProxyWrite : StateConnected;
+        _fastOpen = fastOpen;
     }
 #endif
     try
@@ -58,7 +69,8 @@ StreamSocket::StreamSocket(const ProtocolInstancePtr& instance, SOCKET fd) :
     _instance(instance),
     _addr(),
     _sourceAddr(),
-    _state(StateConnected)
+    _state(StateConnected),
+    _fastOpen(false)
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead), _write(SocketOperationWrite)
 #endif
@@ -228,6 +240,92 @@ StreamSocket::write(Buffer& buf)
     return buf.i != buf.b.end() ? SocketOperationWrite : SocketOperationNone;
 }
 
+SocketOperation
+StreamSocket::write(Buffer& first, Buffer& second)
+{
+#if defined(_WIN32)
+    SocketOperation op = write(first);
+    if(op)
+    {
+        return op;
+    }
+    return write(second);
+#else
+    if(_state == StateProxyWrite || first.i == first.b.end() || second.i == second.b.end())
+    {
+        SocketOperation op = write(first);
+        if(op)
+        {
+            return op;
+        }
+        return write(second);
+    }
+
+    //
+    // Write both buffers with a single writev call.
+    //
+    assert(_fd != INVALID_SOCKET);
+    while(first.i != first.b.end() || second.i != second.b.end())
+    {
+        iovec iov[2];
+        int count = 0;
+        if(first.i != first.b.end())
+        {
+            iov[count].iov_base = &*first.i;
+            iov[count].iov_len = first.b.end() - first.i;
+            ++count;
+        }
+        iov[count].iov_base = &*second.i;
+        iov[count].iov_len = second.b.end() - second.i;
+        ++count;
+
+        ssize_t ret = ::writev(_fd, iov, count);
+        if(ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(wouldBlock() || (_fastOpen && connectInProgress()))
+            {
+                return SocketOperationWrite;
+            }
+
+            if(_fastOpen && connectionRefused())
+            {
+                throw Ice::ConnectionRefusedException(__FILE__, __LINE__, getSocketErrno());
+            }
+
+            if(connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        size_t n = static_cast<size_t>(first.b.end() - first.i);
+        if(static_cast<size_t>(ret) < n)
+        {
+            first.i += ret;
+        }
+        else
+        {
+            first.i = first.b.end();
+            second.i += ret - n;
+        }
+    }
+    return SocketOperationNone;
+#endif
+}
+
 #if !defined(ICE_OS_UWP)
 ssize_t
 StreamSocket::read(char* buf, size_t length)
@@ -237,6 +335,29 @@ StreamSocket::read(char* buf, size_t length)
     size_t packetSize = length;
     ssize_t read = 0;
 
+#ifndef _WIN32
+    //
+    // The connection handshake isn't confirmed yet. If nothing was written
+    // so far (the peer speaks first), this sends the SYN deferred by TCP
+    // Fast Open, otherwise it only reports a pending connection failure.
+    //
+    if(_fastOpen && ::send(_fd, 0, 0, 0) == SOCKET_ERROR && !interrupted() && !wouldBlock() && !connectInProgress())
+    {
+        if(connectionRefused())
+        {
+            throw Ice::ConnectionRefusedException(__FILE__, __LINE__, getSocketErrno());
+        }
+        else if(connectionLost())
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+        }
+        else
+        {
+            throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+        }
+    }
+#endif
+
     while(length > 0)
     {
 #ifdef _WIN32
@@ -266,6 +387,11 @@ StreamSocket::read(char* buf, size_t length)
                 return read;
             }
 
+            if(_fastOpen && connectionRefused())
+            {
+                throw Ice::ConnectionRefusedException(__FILE__, __LINE__, getSocketErrno());
+            }
+
             if(connectionLost())
             {
                 throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
@@ -279,6 +405,7 @@ StreamSocket::read(char* buf, size_t length)
         buf += ret;
         read += ret;
         length -= ret;
+        _fastOpen = false;
 
         if(packetSize > length)
         {
@@ -328,11 +455,16 @@ StreamSocket::write(const char* buf, size_t length)
                 continue;
             }
 
-            if(wouldBlock())
+            if(wouldBlock() || (_fastOpen && connectInProgress()))
             {
                 return sent;
             }
 
+            if(_fastOpen && connectionRefused())
+            {
+                throw Ice::ConnectionRefusedException(__FILE__, __LINE__, getSocketErrno());
+            }
+
             if(connectionLost())
             {
                 throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
@@ -35,6 +35,7 @@ public:
 
     SocketOperation read(Buffer&);
     SocketOperation write(Buffer&);
+    SocketOperation write(Buffer&, Buffer&);
 
 #if !defined(ICE_OS_UWP)
     ssize_t read(char*, size_t);
@@ -77,6 +78,7 @@ private:
 
     State _state;
     std::string _desc;
+    bool _fastOpen;
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     size_t _maxSendPacketSize;
@@ -242,6 +242,17 @@ IceInternal::TcpAcceptor::accept()
     return new TcpTransceiver(_instance, new StreamSocket(_instance, doAccept(_fd)));
 }
 
+TransceiverPtr
+IceInternal::TcpAcceptor::tryAccept()
+{
+    SOCKET fd = doTryAccept(_fd);
+    if(fd == INVALID_SOCKET)
+    {
+        return 0;
+    }
+    return new TcpTransceiver(_instance, new StreamSocket(_instance, fd));
+}
+
 #endif
 
 string
@@ -279,7 +290,8 @@ IceInternal::TcpAcceptor::effectivePort() const
 IceInternal::TcpAcceptor::TcpAcceptor(const TcpEndpointIPtr& endpoint,
                                       const ProtocolInstancePtr& instance,
                                       const string& host,
-                                      int port) :
+                                      int port,
+                                      bool reusePort) :
     _endpoint(endpoint),
     _instance(instance),
     _addr(getAddressForServer(host, port, _instance->protocolSupport(), instance->preferIPv6(), true))
@@ -342,6 +354,22 @@ IceInternal::TcpAcceptor::TcpAcceptor(const TcpEndpointIPtr& endpoint,
     //
     setReuseAddress(_fd, true);
 #endif
+
+    if(reusePort)
+    {
+        setReusePort(_fd, true);
+    }
+
+#if !defined(ICE_OS_UWP)
+    //
+    // Accept data carried in the SYN of clients holding a Fast Open
+    // cookie, the pending Fast Open queue is bounded by the backlog.
+    //
+    if(instance->properties()->getPropertyAsInt("Ice.TCP.FastOpen") > 0)
+    {
+        setTcpFastOpen(_fd, _backlog);
+    }
+#endif
 }
 
 IceInternal::TcpAcceptor::~TcpAcceptor()
@@ -41,6 +41,9 @@ public:
 #endif
 
     virtual TransceiverPtr accept();
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    virtual TransceiverPtr tryAccept();
+#endif
     virtual std::string protocol() const;
     virtual std::string toString() const;
     virtual std::string toDetailedString() const;
@@ -49,7 +52,7 @@ public:
 
 private:
 
-    TcpAcceptor(const TcpEndpointIPtr&, const ProtocolInstancePtr&, const std::string&, int);
+    TcpAcceptor(const TcpEndpointIPtr&, const ProtocolInstancePtr&, const std::string&, int, bool);
     virtual ~TcpAcceptor();
     friend class TcpEndpointI;
 
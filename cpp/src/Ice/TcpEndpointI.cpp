@@ -16,6 +16,7 @@
 #include <Ice/InputStream.h>
 #include <Ice/LocalException.h>
 #include <Ice/ProtocolInstance.h>
+#include <Ice/Properties.h>
 #include <Ice/HashUtil.h>
 
 using namespace std;
@@ -129,9 +130,16 @@ IceInternal::TcpEndpointI::transceiver() const
 }
 
 AcceptorPtr
-IceInternal::TcpEndpointI::acceptor(const string&) const
+IceInternal::TcpEndpointI::acceptor(const string& adapterName) const
 {
-    return new TcpAcceptor(ICE_DYNAMIC_CAST(TcpEndpointI, ICE_SHARED_FROM_CONST_THIS(TcpEndpointI)), _instance, _host, _port);
+    //
+    // If the object adapter listens on this endpoint with several
+    // sockets, they all share the same port with SO_REUSEPORT.
+    //
+    bool reusePort = !adapterName.empty() &&
+        _instance->properties()->getPropertyAsIntWithDefault(adapterName + ".Acceptors", 1) > 1;
+    return new TcpAcceptor(ICE_DYNAMIC_CAST(TcpEndpointI, ICE_SHARED_FROM_CONST_THIS(TcpEndpointI)), _instance, _host, _port,
+                           reusePort);
 }
 
 TcpEndpointIPtr
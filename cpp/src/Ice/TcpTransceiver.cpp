@@ -56,6 +56,12 @@ IceInternal::TcpTransceiver::read(Buffer& buf)
     return _stream->read(buf);
 }
 
+SocketOperation
+IceInternal::TcpTransceiver::gatherWrite(Buffer& first, Buffer& second)
+{
+    return _stream->write(first, second);
+}
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
 bool
 IceInternal::TcpTransceiver::startWrite(Buffer& buf)
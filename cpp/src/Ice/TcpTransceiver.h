@@ -33,6 +33,7 @@ public:
     virtual void close();
     virtual SocketOperation write(Buffer&);
     virtual SocketOperation read(Buffer&);
+    virtual SocketOperation gatherWrite(Buffer&, Buffer&);
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&);
     virtual void finishWrite(Buffer&);
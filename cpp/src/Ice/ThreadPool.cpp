@@ -264,6 +264,7 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _priority(0),
     _serverIdleTime(timeout),
     _threadIdleTime(0),
+    _busyPoll(0),
     _stackSize(0),
     _inUse(0),
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
@@ -346,6 +347,24 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _selector.setup(_sizeIO);
 #endif
 
+    int busyPoll = properties->getPropertyAsInt(_prefix + ".BusyPoll");
+    if(busyPoll < 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".BusyPoll < 0; BusyPoll adjusted to 0";
+        busyPoll = 0;
+    }
+#if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL) || defined(ICE_USE_SELECT) || defined(ICE_USE_POLL)
+    const_cast<int&>(_busyPoll) = busyPoll;
+    _selector.setBusyPoll(_busyPoll);
+#else
+    if(busyPoll > 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".BusyPoll is not supported on this platform and is ignored";
+    }
+#endif
+
 #if defined(__APPLE__)
     //
     // We use a default stack size of 1MB on macOS and the new C++11 mapping to allow transmitting
@@ -380,6 +399,10 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
         out << "creating " << _prefix << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = "
             << _sizeWarn;
+        if(_busyPoll > 0)
+        {
+            out << ", BusyPoll = " << _busyPoll << "us";
+        }
     }
 
     __setNoDelete(true);
@@ -597,6 +620,16 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         (*p)->getThreadControl().join();
     }
+
+#if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL) || defined(ICE_USE_SELECT) || defined(ICE_USE_POLL)
+    if(_busyPoll > 0 && _instance->traceLevels()->threadPool >= 1)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+        out << _prefix << " busy polled for " << _selector.getBusyPollTime().toMilliSecondsDouble() << "ms, "
+            << _selector.getBusyPollHits() << " of " << _selector.getBusyPollCount()
+            << " selects found ready events without blocking";
+    }
+#endif
     _selector.destroy();
 }
 
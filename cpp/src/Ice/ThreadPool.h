@@ -156,6 +156,7 @@ private:
     const int _priority;
     const int _serverIdleTime;
     const int _threadIdleTime;
+    const int _busyPoll; // Microseconds the selecting thread polls before blocking.
     const size_t _stackSize;
 
     std::set<EventHandlerThreadPtr> _threads; // All threads, running or not.
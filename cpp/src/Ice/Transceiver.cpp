@@ -21,3 +21,31 @@ IceInternal::Transceiver::bind()
     assert(false);
     return 0;
 }
+
+//
+// Called instead of write() when other messages are waiting to be sent. A
+// transceiver which can send several messages with a single system call
+// keeps the message and returns true, the message is then sent with the
+// next write().
+//
+bool
+IceInternal::Transceiver::queue(Buffer&)
+{
+    return false;
+}
+
+//
+// Write the data of the first buffer followed by the data of the second
+// buffer. Transceivers which support vectored writes override this to send
+// both with a single system call.
+//
+SocketOperation
+IceInternal::Transceiver::gatherWrite(Buffer& first, Buffer& second)
+{
+    SocketOperation op = write(first);
+    if(op)
+    {
+        return op;
+    }
+    return write(second);
+}
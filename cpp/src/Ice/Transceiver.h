@@ -34,6 +34,8 @@ public:
     virtual EndpointIPtr bind();
     virtual SocketOperation write(Buffer&) = 0;
     virtual SocketOperation read(Buffer&) = 0;
+    virtual bool queue(Buffer&);
+    virtual SocketOperation gatherWrite(Buffer&, Buffer&);
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&) = 0;
     virtual void finishWrite(Buffer&) = 0;
@@ -21,6 +21,13 @@
 #   include <ppltasks.h> // For Concurrency::task
 #endif
 
+#ifdef ICE_USE_UDP_GSO
+#   include <netinet/udp.h>
+#   ifndef UDP_SEGMENT
+#      define UDP_SEGMENT 103
+#   endif
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -191,6 +198,13 @@ IceInternal::UdpTransceiver::write(Buffer& buf)
     // The caller is supposed to check the send size before by calling checkSendSize
     assert(min(_maxPacketSize, _sndSize - _udpOverhead) >= static_cast<int>(buf.b.size()));
 
+#ifdef ICE_USE_UDP_GSO
+    if(!_sndBuffer.empty())
+    {
+        return writeSegments(buf);
+    }
+#endif
+
 repeat:
 
     ssize_t ret;
@@ -264,6 +278,12 @@ IceInternal::UdpTransceiver::read(Buffer& buf)
     assert(_fd != INVALID_SOCKET);
 
     const int packetSize = min(_maxPacketSize, _rcvSize - _udpOverhead);
+#ifdef ICE_USE_RECVMMSG
+    if(_rcvBatchSize > 1 && _state == StateNotConnected)
+    {
+        return readBatch(buf, packetSize);
+    }
+#endif
     buf.b.resize(packetSize);
     buf.i = buf.b.begin();
 
@@ -351,6 +371,245 @@ repeat:
 #endif
 }
 
+#ifdef ICE_USE_UDP_GSO
+bool
+IceInternal::UdpTransceiver::queue(Buffer& buf)
+{
+    assert(buf.i == buf.b.begin());
+    if(_sndBatchSize <= 1 || _state != StateConnected)
+    {
+        return false;
+    }
+
+    if(_sndSegmentMax == 0)
+    {
+        //
+        // Check if the kernel supports UDP segmentation offload and compute
+        // the largest segment which doesn't require IP fragmentation.
+        //
+        const bool ipv6 = _addr.saStorage.ss_family == AF_INET6;
+        int gso = 0;
+        socklen_t gsoLen = static_cast<socklen_t>(sizeof(int));
+        int mtu = 0;
+        socklen_t mtuLen = static_cast<socklen_t>(sizeof(int));
+        if(getsockopt(_fd, SOL_UDP, UDP_SEGMENT, &gso, &gsoLen) == SOCKET_ERROR ||
+           getsockopt(_fd, ipv6 ? IPPROTO_IPV6 : IPPROTO_IP, ipv6 ? IPV6_MTU : IP_MTU, &mtu, &mtuLen) == SOCKET_ERROR ||
+           mtu <= (ipv6 ? 48 : 28))
+        {
+            _sndBatchSize = 1;
+            return false;
+        }
+        _sndSegmentMax = static_cast<size_t>(mtu - (ipv6 ? 48 : 28));
+    }
+
+    //
+    // Only datagrams of the same size can be sent together. Room is kept for
+    // the datagram given to the next write(), the last segment can be shorter.
+    //
+    const size_t size = buf.b.size();
+    if(_sndBuffer.empty())
+    {
+        if(size > _sndSegmentMax)
+        {
+            return false;
+        }
+        _sndSegmentSize = size;
+    }
+    else if(size != _sndSegmentSize ||
+            _sndBuffer.size() / _sndSegmentSize + 1 >= static_cast<size_t>(_sndBatchSize) ||
+            _sndBuffer.size() + 2 * size > static_cast<size_t>(min(_maxPacketSize, _sndSize - _udpOverhead)))
+    {
+        return false;
+    }
+
+    _sndBuffer.insert(_sndBuffer.end(), buf.b.begin(), buf.b.end());
+    buf.i = buf.b.end();
+    return true;
+}
+
+SocketOperation
+IceInternal::UdpTransceiver::writeSegments(Buffer& buf)
+{
+    assert(_state == StateConnected && _sndSegmentSize > 0 && !_sndBuffer.empty());
+
+    if(_sndBatchSize > 1)
+    {
+        //
+        // Send the queued datagrams and, if it's not larger than the segment
+        // size, the given datagram with a single sendmsg call. The kernel
+        // splits the payload into _sndSegmentSize datagrams.
+        //
+        const bool append = buf.b.size() <= _sndSegmentSize &&
+            _sndBuffer.size() + buf.b.size() <= static_cast<size_t>(min(_maxPacketSize, _sndSize - _udpOverhead));
+
+        iovec iov[2];
+        iov[0].iov_base = &_sndBuffer[0];
+        iov[0].iov_len = _sndBuffer.size();
+        iov[1].iov_base = &buf.b[0];
+        iov[1].iov_len = buf.b.size();
+
+        char control[CMSG_SPACE(sizeof(uint16_t))];
+        memset(control, 0, sizeof(control));
+        msghdr msg;
+        memset(&msg, 0, sizeof(msghdr));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = append ? 2 : 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        const uint16_t segmentSize = static_cast<uint16_t>(_sndSegmentSize);
+        memcpy(CMSG_DATA(cmsg), &segmentSize, sizeof(uint16_t));
+
+    repeat:
+
+        ssize_t ret = ::sendmsg(_fd, &msg, 0);
+        if(ret != SOCKET_ERROR)
+        {
+            _sndBuffer.clear();
+            if(!append)
+            {
+                return write(buf);
+            }
+            buf.i = buf.b.end();
+            return SocketOperationNone;
+        }
+
+        if(interrupted())
+        {
+            goto repeat;
+        }
+
+        if(wouldBlock())
+        {
+            return SocketOperationWrite;
+        }
+
+        const int error = getSocketErrno();
+        if(error != EIO && error != EINVAL && error != EMSGSIZE)
+        {
+            throw SocketException(__FILE__, __LINE__, error);
+        }
+
+        //
+        // The network device or the route doesn't support segmentation (EIO is
+        // returned for devices without checksum offload), disable it and fall
+        // back to sending the queued datagrams one by one.
+        //
+        _sndBatchSize = 1;
+    }
+
+    while(!_sndBuffer.empty())
+    {
+        ssize_t ret = ::send(_fd, reinterpret_cast<const char*>(&_sndBuffer[0]), _sndSegmentSize, 0);
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            throw SocketException(__FILE__, __LINE__, getSocketErrno());
+        }
+        _sndBuffer.erase(_sndBuffer.begin(), _sndBuffer.begin() + _sndSegmentSize);
+    }
+    return write(buf);
+}
+#endif
+
+#ifdef ICE_USE_RECVMMSG
+SocketOperation
+IceInternal::UdpTransceiver::readBatch(Buffer& buf, int packetSize)
+{
+    if(_rcvNext == _rcvCount)
+    {
+        //
+        // All the datagrams from the previous batch were returned, receive
+        // a new batch. The slots are allocated with the first batch and
+        // resized here, when no datagram is pending, to follow changes of
+        // the receive buffer size.
+        //
+        if(!_rcvSlots)
+        {
+            _rcvSlots = new Buffer::Container[_rcvBatchSize];
+            _rcvMsgs.resize(_rcvBatchSize);
+            _rcvIovecs.resize(_rcvBatchSize);
+            _rcvAddrs.resize(_rcvBatchSize);
+        }
+
+        for(int i = 0; i < _rcvBatchSize; ++i)
+        {
+            _rcvSlots[i].resize(packetSize);
+            _rcvIovecs[i].iov_base = _rcvSlots[i].begin();
+            _rcvIovecs[i].iov_len = packetSize;
+
+            memset(&_rcvMsgs[i], 0, sizeof(mmsghdr));
+            _rcvMsgs[i].msg_hdr.msg_iov = &_rcvIovecs[i];
+            _rcvMsgs[i].msg_hdr.msg_iovlen = 1;
+            _rcvMsgs[i].msg_hdr.msg_name = &_rcvAddrs[i].saStorage;
+            _rcvMsgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(sizeof(sockaddr_storage));
+        }
+
+    repeat:
+
+        int ret = recvmmsg(_fd, &_rcvMsgs[0], _rcvBatchSize, 0, 0);
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                goto repeat;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationRead;
+            }
+
+            if(connectionLost())
+            {
+                throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        _rcvCount = ret;
+        _rcvNext = 0;
+    }
+
+    //
+    // Return the next datagram of the batch. A truncated datagram fills
+    // the whole buffer, this is detected at the connection level when the
+    // Ice message size is checked against the buffer size.
+    //
+    // The datagram isn't copied: the read buffer takes the slot storage
+    // and its previous storage is reused by the slot for the next batch.
+    //
+    buf.b.swap(_rcvSlots[_rcvNext]);
+    buf.b.resize(_rcvMsgs[_rcvNext].msg_len);
+    buf.i = buf.b.end();
+    _peerAddr = _rcvAddrs[_rcvNext];
+    ++_rcvNext;
+
+    //
+    // Let the thread pool know if more datagrams are pending, they can be
+    // read without waiting for the socket to be reported as readable.
+    //
+    ready(SocketOperationRead, _rcvNext < _rcvCount);
+    return SocketOperationNone;
+}
+#endif
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
 bool
 IceInternal::UdpTransceiver::startWrite(Buffer& buf)
@@ -894,6 +1153,17 @@ IceInternal::UdpTransceiver::UdpTransceiver(const ProtocolInstancePtr& instance,
     _bound(false),
     _addr(addr),
     _state(StateNeedConnect)
+#if defined(ICE_USE_RECVMMSG)
+    , _rcvBatchSize(1),
+    _rcvSlots(0),
+    _rcvCount(0),
+    _rcvNext(0)
+#endif
+#if defined(ICE_USE_UDP_GSO)
+    , _sndBatchSize(min(64, max(1, instance->properties()->getPropertyAsIntWithDefault("Ice.UDP.SndBatchSize", 1)))),
+    _sndSegmentMax(0),
+    _sndSegmentSize(0)
+#endif
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead),
     _write(SocketOperationWrite)
@@ -975,6 +1245,17 @@ IceInternal::UdpTransceiver::UdpTransceiver(const UdpEndpointIPtr& endpoint, con
     _mcastInterface(mcastInterface),
     _port(port),
     _state(connect ? StateNeedConnect : StateNotConnected)
+#if defined(ICE_USE_RECVMMSG)
+    , _rcvBatchSize(max(1, instance->properties()->getPropertyAsIntWithDefault("Ice.UDP.RcvBatchSize", 1))),
+    _rcvSlots(0),
+    _rcvCount(0),
+    _rcvNext(0)
+#endif
+#if defined(ICE_USE_UDP_GSO)
+    , _sndBatchSize(1),
+    _sndSegmentMax(0),
+    _sndSegmentSize(0)
+#endif
 #ifdef ICE_OS_UWP
     , _readPending(false)
 #elif defined(ICE_USE_IOCP)
@@ -1013,6 +1294,9 @@ IceInternal::UdpTransceiver::UdpTransceiver(const UdpEndpointIPtr& endpoint, con
 IceInternal::UdpTransceiver::~UdpTransceiver()
 {
     assert(_fd == INVALID_SOCKET);
+#if defined(ICE_USE_RECVMMSG)
+    delete[] _rcvSlots;
+#endif
 }
 
 //
@@ -20,6 +20,16 @@
 #   include <deque>
 #endif
 
+//
+// On Linux, incoming datagrams can be received in batches with recvmmsg
+// (Ice.UDP.RcvBatchSize) and queued outgoing datagrams sent with UDP
+// segmentation offload (Ice.UDP.SndBatchSize).
+//
+#if defined(ICE_USE_EPOLL)
+#   define ICE_USE_RECVMMSG 1
+#   define ICE_USE_UDP_GSO 1
+#endif
+
 namespace IceInternal
 {
 
@@ -48,6 +58,9 @@ public:
     virtual EndpointIPtr bind();
     virtual SocketOperation write(Buffer&);
     virtual SocketOperation read(Buffer&);
+#if defined(ICE_USE_UDP_GSO)
+    virtual bool queue(Buffer&);
+#endif
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&);
     virtual void finishWrite(Buffer&);
@@ -72,6 +85,12 @@ private:
     virtual ~UdpTransceiver();
 
     void setBufSize(int, int);
+#ifdef ICE_USE_RECVMMSG
+    SocketOperation readBatch(Buffer&, int);
+#endif
+#ifdef ICE_USE_UDP_GSO
+    SocketOperation writeSegments(Buffer&);
+#endif
 
 #ifdef ICE_OS_UWP
     void appendMessage(Windows::Networking::Sockets::DatagramSocketMessageReceivedEventArgs^);
@@ -104,6 +123,32 @@ private:
     static const int _udpOverhead;
     static const int _maxPacketSize;
 
+#if defined(ICE_USE_RECVMMSG)
+    //
+    // The datagrams received with the last recvmmsg call and not yet
+    // returned by read(). Each datagram is received in its own slot and
+    // the slot storage is swapped with the read buffer to return it.
+    //
+    int _rcvBatchSize;
+    Buffer::Container* _rcvSlots;
+    std::vector<mmsghdr> _rcvMsgs;
+    std::vector<iovec> _rcvIovecs;
+    std::vector<Address> _rcvAddrs;
+    int _rcvCount;
+    int _rcvNext;
+#endif
+
+#if defined(ICE_USE_UDP_GSO)
+    //
+    // The datagrams accepted by queue() and not sent yet. They all have
+    // _sndSegmentSize bytes and are sent with the next write().
+    //
+    int _sndBatchSize;
+    size_t _sndSegmentMax;
+    size_t _sndSegmentSize;
+    std::vector<Ice::Byte> _sndBuffer;
+#endif
+
 #if defined(ICE_USE_IOCP)
     AsyncInfo _read;
     AsyncInfo _write;
@@ -63,7 +63,18 @@ IceInternal::WSAcceptor::accept()
     // WebSocket handshaking is performed in TransceiverI::initialize, since
     // accept must not block.
     //
-    return new WSTransceiver(_instance, _delegate->accept());
+    return new WSTransceiver(_instance, _delegate->accept(), _endpoint->deflate());
+}
+
+IceInternal::TransceiverPtr
+IceInternal::WSAcceptor::tryAccept()
+{
+    TransceiverPtr del = _delegate->tryAccept();
+    if(!del)
+    {
+        return 0;
+    }
+    return new WSTransceiver(_instance, del, _endpoint->deflate());
 }
 
 string
@@ -37,6 +37,7 @@ public:
     virtual void finishAccept();
 #endif
     virtual TransceiverPtr accept();
+    virtual TransceiverPtr tryAccept();
     virtual std::string protocol() const;
     virtual std::string toString() const;
     virtual std::string toDetailedString() const;
@@ -19,7 +19,7 @@ using namespace IceInternal;
 TransceiverPtr
 IceInternal::WSConnector::connect()
 {
-    return new WSTransceiver(_instance, _delegate->connect(), _host, _resource);
+    return new WSTransceiver(_instance, _delegate->connect(), _host, _resource, _deflate);
 }
 
 Short
@@ -58,6 +58,11 @@ IceInternal::WSConnector::operator==(const Connector& r) const
         return false;
     }
 
+    if(!(_deflate == p->_deflate))
+    {
+        return false;
+    }
+
     return true;
 }
 
@@ -93,12 +98,21 @@ IceInternal::WSConnector::operator<(const Connector& r) const
         return false;
     }
 
+    if(_deflate < p->_deflate)
+    {
+        return true;
+    }
+    else if(p->_deflate < _deflate)
+    {
+        return false;
+    }
+
     return false;
 }
 
 IceInternal::WSConnector::WSConnector(const ProtocolInstancePtr& instance, const ConnectorPtr& del, const string& host,
-                                      const string& resource) :
-    _instance(instance), _delegate(del), _host(host), _resource(resource)
+                                      const string& resource, const WSDeflateConfig& deflate) :
+    _instance(instance), _delegate(del), _host(host), _resource(resource), _deflate(deflate)
 {
 }
 
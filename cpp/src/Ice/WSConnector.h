@@ -14,12 +14,11 @@
 #include <Ice/TransceiverF.h>
 #include <Ice/Connector.h>
 #include <Ice/ProtocolInstance.h>
+#include <Ice/WSEndpoint.h>
 
 namespace IceInternal
 {
 
-class WSEndpoint;
-
 class WSConnector : public Connector
 {
 public:
@@ -32,7 +31,8 @@ public:
     virtual bool operator==(const Connector&) const;
     virtual bool operator<(const Connector&) const;
 
-    WSConnector(const ProtocolInstancePtr&, const ConnectorPtr&, const std::string&, const std::string&);
+    WSConnector(const ProtocolInstancePtr&, const ConnectorPtr&, const std::string&, const std::string&,
+                const WSDeflateConfig&);
     virtual ~WSConnector();
 
 private:
@@ -41,6 +41,7 @@ private:
     const ConnectorPtr _delegate;
     const std::string _host;
     const std::string _resource;
+    const WSDeflateConfig _deflate;
 };
 
 }
@@ -104,8 +104,9 @@ WSEndpointFactoryPlugin::destroy()
 {
 }
 
-IceInternal::WSEndpoint::WSEndpoint(const ProtocolInstancePtr& instance, const EndpointIPtr& del, const string& res) :
-    _instance(instance), _delegate(del), _resource(res)
+IceInternal::WSEndpoint::WSEndpoint(const ProtocolInstancePtr& instance, const EndpointIPtr& del, const string& res,
+                                    const WSDeflateConfig& deflate) :
+    _instance(instance), _delegate(del), _resource(res), _deflate(deflate)
 {
 }
 
@@ -171,7 +172,7 @@ IceInternal::WSEndpoint::timeout(Int timeout) const
     }
     else
     {
-        return ICE_MAKE_SHARED(WSEndpoint, _instance, _delegate->timeout(timeout), _resource);
+        return ICE_MAKE_SHARED(WSEndpoint, _instance, _delegate->timeout(timeout), _resource, _deflate);
     }
 }
 
@@ -190,7 +191,8 @@ IceInternal::WSEndpoint::connectionId(const string& connectionId) const
     }
     else
     {
-        return ICE_MAKE_SHARED(WSEndpoint, _instance, _delegate->connectionId(connectionId), _resource);
+        return ICE_MAKE_SHARED(WSEndpoint, _instance, _delegate->connectionId(connectionId), _resource,
+                               _deflate);
     }
 }
 
@@ -209,7 +211,7 @@ IceInternal::WSEndpoint::compress(bool compress) const
     }
     else
     {
-        return ICE_MAKE_SHARED(WSEndpoint, _instance, _delegate->compress(compress), _resource);
+        return ICE_MAKE_SHARED(WSEndpoint, _instance, _delegate->compress(compress), _resource, _deflate);
     }
 }
 
@@ -240,8 +242,8 @@ IceInternal::WSEndpoint::connectors_async(EndpointSelectionType selType,
     public:
 
         CallbackI(const EndpointI_connectorsPtr& callback, const ProtocolInstancePtr& instance,
-                  const string& host, const string& resource) :
-            _callback(callback), _instance(instance), _host(host), _resource(resource)
+                  const string& host, const string& resource, const WSDeflateConfig& deflate) :
+            _callback(callback), _instance(instance), _host(host), _resource(resource), _deflate(deflate)
         {
         }
 
@@ -250,7 +252,7 @@ IceInternal::WSEndpoint::connectors_async(EndpointSelectionType selType,
             vector<ConnectorPtr> connectors = c;
             for(vector<ConnectorPtr>::iterator p = connectors.begin(); p != connectors.end(); ++p)
             {
-                *p = new WSConnector(_instance, *p, _host, _resource);
+                *p = new WSConnector(_instance, *p, _host, _resource, _deflate);
             }
             _callback->connectors(connectors);
         }
@@ -266,6 +268,7 @@ IceInternal::WSEndpoint::connectors_async(EndpointSelectionType selType,
         const ProtocolInstancePtr _instance;
         const string _host;
         const string _resource;
+        const WSDeflateConfig _deflate;
     };
 
     ostringstream host;
@@ -274,7 +277,8 @@ IceInternal::WSEndpoint::connectors_async(EndpointSelectionType selType,
     {
         host << info->host << ":" << info->port;
     }
-    _delegate->connectors_async(selType, ICE_MAKE_SHARED(CallbackI, callback, _instance, host.str(), _resource));
+    _delegate->connectors_async(selType, ICE_MAKE_SHARED(CallbackI, callback, _instance, host.str(), _resource,
+                                                         _deflate));
 }
 
 AcceptorPtr
@@ -284,6 +288,12 @@ IceInternal::WSEndpoint::acceptor(const string& adapterName) const
     return new WSAcceptor(ICE_SHARED_FROM_CONST_THIS(WSEndpoint), _instance, delAcc);
 }
 
+const WSDeflateConfig&
+IceInternal::WSEndpoint::deflate() const
+{
+    return _deflate;
+}
+
 WSEndpointPtr
 IceInternal::WSEndpoint::endpoint(const EndpointIPtr& delEndp) const
 {
@@ -293,7 +303,7 @@ IceInternal::WSEndpoint::endpoint(const EndpointIPtr& delEndp) const
     }
     else
     {
-        return ICE_MAKE_SHARED(WSEndpoint, _instance, delEndp, _resource);
+        return ICE_MAKE_SHARED(WSEndpoint, _instance, delEndp, _resource, _deflate);
     }
 }
 
@@ -309,7 +319,7 @@ IceInternal::WSEndpoint::expandIfWildcard() const
         }
         else
         {
-            *p = ICE_MAKE_SHARED(WSEndpoint, _instance, *p, _resource);
+            *p = ICE_MAKE_SHARED(WSEndpoint, _instance, *p, _resource, _deflate);
         }
     }
     return endps;
@@ -325,7 +335,7 @@ IceInternal::WSEndpoint::expandHost(EndpointIPtr& publish) const
     }
     else if(publish.get())
     {
-        publish = ICE_MAKE_SHARED(WSEndpoint, _instance, publish, _resource);
+        publish = ICE_MAKE_SHARED(WSEndpoint, _instance, publish, _resource, _deflate);
     }
     for(vector<EndpointIPtr>::iterator p = endps.begin(); p != endps.end(); ++p)
     {
@@ -335,7 +345,7 @@ IceInternal::WSEndpoint::expandHost(EndpointIPtr& publish) const
         }
         else
         {
-            *p = ICE_MAKE_SHARED(WSEndpoint, _instance, *p, _resource);
+            *p = ICE_MAKE_SHARED(WSEndpoint, _instance, *p, _resource, _deflate);
         }
     }
     return endps;
@@ -357,6 +367,9 @@ IceInternal::WSEndpoint::hash() const
 {
     int h = _delegate->hash();
     hashAdd(h, _resource);
+    hashAdd(h, _deflate.enabled);
+    hashAdd(h, _deflate.windowBits);
+    hashAdd(h, _deflate.noContextTakeover);
     return h;
 }
 
@@ -388,6 +401,19 @@ IceInternal::WSEndpoint::options() const
         }
     }
 
+    if(_deflate.enabled)
+    {
+        s << " --deflate";
+        if(_deflate.windowBits != 15)
+        {
+            s << " --deflateWindowBits " << _deflate.windowBits;
+        }
+        if(_deflate.noContextTakeover)
+        {
+            s << " --deflateNoContextTakeover";
+        }
+    }
+
     return s.str();
 }
 
@@ -419,6 +445,11 @@ IceInternal::WSEndpoint::operator==(const LocalObject& r) const
         return false;
     }
 
+    if(!(_deflate == p->_deflate))
+    {
+        return false;
+    }
+
     return true;
 }
 
@@ -463,12 +494,60 @@ IceInternal::WSEndpoint::operator<(const LocalObject& r) const
         return false;
     }
 
+    if(_deflate < p->_deflate)
+    {
+        return true;
+    }
+    else if(p->_deflate < _deflate)
+    {
+        return false;
+    }
+
     return false;
 }
 
 bool
 IceInternal::WSEndpoint::checkOption(const string& option, const string& argument, const string& endpoint)
 {
+    if(option == "--deflate" || option == "--deflateNoContextTakeover")
+    {
+        if(!argument.empty())
+        {
+            throw EndpointParseException(__FILE__, __LINE__, "unexpected argument `" + argument + "' provided for " +
+                                         option + " option in endpoint " + endpoint + _delegate->options());
+        }
+#ifndef ICE_HAS_ZLIB
+        throw FeatureNotSupportedException(__FILE__, __LINE__, "WebSocket permessage-deflate");
+#else
+        const_cast<WSDeflateConfig&>(_deflate).enabled = true;
+        if(option == "--deflateNoContextTakeover")
+        {
+            const_cast<WSDeflateConfig&>(_deflate).noContextTakeover = true;
+        }
+        return true;
+#endif
+    }
+    else if(option == "--deflateWindowBits")
+    {
+        //
+        // zlib doesn't support compressing with a raw deflate window of 8 bits.
+        //
+        istringstream p(argument);
+        int windowBits;
+        if(!(p >> windowBits) || !p.eof() || windowBits < 9 || windowBits > 15)
+        {
+            throw EndpointParseException(__FILE__, __LINE__, "invalid window size `" + argument + "' provided for " +
+                                         "--deflateWindowBits option in endpoint " + endpoint + _delegate->options());
+        }
+#ifndef ICE_HAS_ZLIB
+        throw FeatureNotSupportedException(__FILE__, __LINE__, "WebSocket permessage-deflate");
+#else
+        const_cast<WSDeflateConfig&>(_deflate).enabled = true;
+        const_cast<WSDeflateConfig&>(_deflate).windowBits = windowBits;
+        return true;
+#endif
+    }
+
     switch(option[1])
     {
     case 'r':
@@ -511,3 +590,23 @@ IceInternal::WSEndpointFactory::readWithUnderlying(const EndpointIPtr& underlyin
 {
     return ICE_MAKE_SHARED(WSEndpoint, _instance, underlying, s);
 }
+
+bool
+IceInternal::WSDeflateConfig::operator==(const WSDeflateConfig& rhs) const
+{
+    return enabled == rhs.enabled && windowBits == rhs.windowBits && noContextTakeover == rhs.noContextTakeover;
+}
+
+bool
+IceInternal::WSDeflateConfig::operator<(const WSDeflateConfig& rhs) const
+{
+    if(enabled != rhs.enabled)
+    {
+        return enabled < rhs.enabled;
+    }
+    if(windowBits != rhs.windowBits)
+    {
+        return windowBits < rhs.windowBits;
+    }
+    return noContextTakeover < rhs.noContextTakeover;
+}
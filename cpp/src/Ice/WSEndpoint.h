@@ -20,6 +20,24 @@
 namespace IceInternal
 {
 
+//
+// The permessage-deflate (RFC 7692) settings of a WebSocket endpoint. These
+// settings are local, they are not marshaled with the endpoint.
+//
+struct WSDeflateConfig
+{
+    WSDeflateConfig() : enabled(false), windowBits(15), noContextTakeover(false)
+    {
+    }
+
+    bool operator==(const WSDeflateConfig&) const;
+    bool operator<(const WSDeflateConfig&) const;
+
+    bool enabled;
+    int windowBits;
+    bool noContextTakeover;
+};
+
 class WSEndpoint : public EndpointI
 #ifdef ICE_CPP11_MAPPING
                  , public std::enable_shared_from_this<WSEndpoint>
@@ -27,7 +45,7 @@ class WSEndpoint : public EndpointI
 {
 public:
 
-    WSEndpoint(const ProtocolInstancePtr&, const EndpointIPtr&, const std::string&);
+    WSEndpoint(const ProtocolInstancePtr&, const EndpointIPtr&, const std::string&, const WSDeflateConfig&);
     WSEndpoint(const ProtocolInstancePtr&, const EndpointIPtr&, std::vector<std::string>&);
     WSEndpoint(const ProtocolInstancePtr&, const EndpointIPtr&, Ice::InputStream*);
 
@@ -56,6 +74,7 @@ public:
     virtual std::string options() const;
 
     WSEndpointPtr endpoint(const EndpointIPtr&) const;
+    const WSDeflateConfig& deflate() const;
 
 #ifdef ICE_CPP11_MAPPING
     virtual bool operator==(const Ice::Endpoint&) const;
@@ -77,6 +96,7 @@ private:
     const ProtocolInstancePtr _instance;
     const EndpointIPtr _delegate;
     const std::string _resource;
+    const WSDeflateConfig _deflate;
 };
 
 class ICE_API WSEndpointFactory : public EndpointFactoryWithUnderlying
@@ -30,6 +30,18 @@ typedef unsigned short uint16_t;
 
 #include <climits>
 
+#ifdef ICE_HAS_ZLIB
+#   include <zlib.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define ICE_WS_MASK_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#   include <arm_neon.h>
+#   define ICE_WS_MASK_NEON
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -54,6 +66,7 @@ using namespace IceInternal;
 #define OP_RES_0xE  0xE     // Reserved
 #define OP_RES_0xF  0xF     // Reserved
 #define FLAG_FINAL  0x80    // Last frame
+#define FLAG_COMPRESSED 0x40 // Message is compressed (RSV1, permessage-deflate)
 #define FLAG_MASKED 0x80    // Payload is masked
 
 #define CLOSURE_NORMAL         1000
@@ -67,6 +80,65 @@ namespace
 const string _iceProtocol = "ice.zeroc.com";
 const string _wsUUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
 
+//
+// The read and write buffers grow up to this size.
+//
+const size_t maxBufferSize = 64 * 1024;
+
+//
+// Messages smaller than this size are not compressed with permessage-deflate.
+//
+const size_t deflateMinSize = 100;
+
+//
+// Parse an element of the Sec-WebSocket-Extensions header. Returns false if it's
+// not a permessage-deflate extension or if a parameter is repeated. Parameters
+// without value are returned with an empty value.
+//
+bool parseDeflateExtension(const string& extension, map<string, string>& params)
+{
+    vector<string> tokens;
+    if(!IceUtilInternal::splitString(extension, ";", tokens) || tokens.empty() ||
+       IceUtilInternal::trim(tokens[0]) != "permessage-deflate")
+    {
+        return false;
+    }
+
+    for(vector<string>::const_iterator p = tokens.begin() + 1; p != tokens.end(); ++p)
+    {
+        string name = IceUtilInternal::trim(*p);
+        string value;
+        string::size_type pos = name.find('=');
+        if(pos != string::npos)
+        {
+            value = IceUtilInternal::trim(name.substr(pos + 1));
+            name = IceUtilInternal::trim(name.substr(0, pos));
+            if(value.empty())
+            {
+                return false;
+            }
+        }
+        if(!params.insert(make_pair(name, value)).second)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//
+// Parse the value of a server_max_window_bits or client_max_window_bits parameter.
+//
+bool parseWindowBits(const string& value, int& windowBits)
+{
+    if(value.empty() || value.size() > 2 || value.find_first_not_of("0123456789") != string::npos)
+    {
+        return false;
+    }
+    windowBits = atoi(value.c_str());
+    return windowBits >= 8 && windowBits <= 15;
+}
+
 //
 // Rename to avoid conflict with OS 10.10 htonll
 //
@@ -133,6 +205,54 @@ Long ice_nlltoh(const Byte* src)
     return v;
 }
 
+//
+// XOR length bytes of src with the 32-bit mask and store them in dst, src and
+// dst can be the same. The offset is the position of src[0] in the payload,
+// it selects the first mask byte to use.
+//
+void applyMask(Byte* dst, const Byte* src, size_t length, const unsigned char* mask, size_t offset)
+{
+    //
+    // The mask repeated to fill a 16 bytes vector, starting with the mask byte
+    // for src[0].
+    //
+    Byte m[16];
+    for(size_t i = 0; i < sizeof(m); ++i)
+    {
+        m[i] = mask[(offset + i) % 4];
+    }
+
+    size_t i = 0;
+#if defined(ICE_WS_MASK_SSE2)
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m));
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(d, v));
+    }
+#elif defined(ICE_WS_MASK_NEON)
+    const uint8x16_t v = vld1q_u8(m);
+    for(; i + 16 <= length; i += 16)
+    {
+        vst1q_u8(dst + i, veorq_u8(vld1q_u8(src + i), v));
+    }
+#else
+    Long v;
+    memcpy(&v, m, sizeof(Long));
+    for(; i + sizeof(Long) <= length; i += sizeof(Long))
+    {
+        Long d;
+        memcpy(&d, src + i, sizeof(Long));
+        d ^= v;
+        memcpy(dst + i, &d, sizeof(Long));
+    }
+#endif
+    for(; i < length; ++i)
+    {
+        dst[i] = src[i] ^ m[i % 16];
+    }
+}
+
 #if defined(ICE_OS_UWP)
 Short htons(Short v)
 {
@@ -234,8 +354,21 @@ IceInternal::WSTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer)
                     << "Upgrade: websocket\r\n"
                     << "Connection: Upgrade\r\n"
                     << "Sec-WebSocket-Protocol: " << _iceProtocol << "\r\n"
-                    << "Sec-WebSocket-Version: 13\r\n"
-                    << "Sec-WebSocket-Key: ";
+                    << "Sec-WebSocket-Version: 13\r\n";
+                if(_deflate.enabled)
+                {
+                    //
+                    // Offer permessage-deflate, we can always inflate with the largest
+                    // window so the server is free to pick its window size.
+                    //
+                    out << "Sec-WebSocket-Extensions: permessage-deflate; client_max_window_bits";
+                    if(_deflate.noContextTakeover)
+                    {
+                        out << "; client_no_context_takeover";
+                    }
+                    out << "\r\n";
+                }
+                out << "Sec-WebSocket-Key: ";
 
                 //
                 // The value for Sec-WebSocket-Key is a 16-byte random number,
@@ -483,6 +616,7 @@ IceInternal::WSTransceiver::close()
     if(!_writePending)
     {
         _writeBuffer.b.clear();
+        _deflateBuffer.b.clear();
     }
     if(!_readPending)
     {
@@ -514,17 +648,30 @@ IceInternal::WSTransceiver::write(Buffer& buf)
     {
         if(preWrite(buf))
         {
+            Buffer& payload = _writeCompressed ? _deflateBuffer : buf;
             if(_writeBuffer.i < _writeBuffer.b.end())
             {
-                SocketOperation s = _delegate->write(_writeBuffer);
+                //
+                // For incoming connections, the payload of large messages isn't
+                // copied to the write buffer, it's written with the frame header.
+                //
+                SocketOperation s;
+                if(_incoming && _writeState == WriteStatePayload && !payload.b.empty() && payload.i != payload.b.end())
+                {
+                    s = _delegate->gatherWrite(_writeBuffer, payload);
+                }
+                else
+                {
+                    s = _delegate->write(_writeBuffer);
+                }
                 if(s)
                 {
                     return s;
                 }
             }
-            else if(_incoming && !buf.b.empty() && _writeState == WriteStatePayload)
+            else if(_incoming && !payload.b.empty() && _writeState == WriteStatePayload)
             {
-                SocketOperation s = _delegate->write(buf);
+                SocketOperation s = _delegate->write(payload);
                 if(s)
                 {
                     return s;
@@ -574,7 +721,7 @@ IceInternal::WSTransceiver::read(Buffer& buf)
     //
     if(buf.i == buf.b.end())
     {
-        if(_readI < _readBuffer.i)
+        if(_readI < _readBuffer.i || inflatePending())
         {
             _delegate->getNativeInfo()->ready(SocketOperationRead, true);
         }
@@ -609,6 +756,14 @@ IceInternal::WSTransceiver::read(Buffer& buf)
             else
             {
                 s = _delegate->read(_readBuffer);
+                if(_readBuffer.i == _readBuffer.b.end() && _readBufferSize < maxBufferSize)
+                {
+                    //
+                    // The read filled the buffer, more data is likely available. Use
+                    // a larger buffer to read it with fewer calls.
+                    //
+                    _readBufferSize = min(_readBufferSize * 2, maxBufferSize);
+                }
             }
 
             if(s == SocketOperationWrite)
@@ -622,7 +777,7 @@ IceInternal::WSTransceiver::read(Buffer& buf)
 
     if(buf.i == buf.b.end())
     {
-        if(_readI < _readBuffer.i)
+        if(_readI < _readBuffer.i || inflatePending())
         {
             _delegate->getNativeInfo()->ready(SocketOperationRead, true);
         }
@@ -673,7 +828,7 @@ IceInternal::WSTransceiver::startWrite(Buffer& buf)
         else
         {
             assert(_incoming);
-            return _delegate->startWrite(buf);
+            return _delegate->startWrite(_writeCompressed ? _deflateBuffer : buf);
         }
     }
     else
@@ -701,14 +856,15 @@ IceInternal::WSTransceiver::finishWrite(Buffer& buf)
         return;
     }
 
+    Buffer& payload = _writeCompressed ? _deflateBuffer : buf;
     if(_writeBuffer.i < _writeBuffer.b.end())
     {
         _delegate->finishWrite(_writeBuffer);
     }
-    else if(!buf.b.empty() && buf.i != buf.b.end())
+    else if(!payload.b.empty() && payload.i != payload.b.end())
     {
         assert(_incoming);
-        _delegate->finishWrite(buf);
+        _delegate->finishWrite(payload);
     }
 
     if(_state == StateClosed)
@@ -850,12 +1006,14 @@ IceInternal::WSTransceiver::setBufferSize(int rcvSize, int sndSize)
 }
 
 IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, const TransceiverPtr& del,
-                                          const string& host, const string& resource) :
+                                          const string& host, const string& resource,
+                                          const WSDeflateConfig& deflate) :
     _instance(instance),
     _delegate(del),
     _host(host),
     _resource(resource),
     _incoming(false),
+    _deflate(deflate),
     _state(StateInitializeDelegate),
     _parser(new HttpParser),
     _readState(ReadStateOpcode),
@@ -864,8 +1022,17 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readOpCode(0),
     _readHeaderLength(0),
     _readPayloadLength(0),
+    _readCompressed(false),
+    _readFramePos(0),
     _writeState(WriteStateHeader),
     _writeBufferSize(16 * 1024),
+    _writePayloadLength(0),
+    _writeCompressed(false),
+    _deflateStream(0),
+    _inflateStream(0),
+    _deflateNoContextTakeover(false),
+    _inflatePos(0),
+    _inflateOutputPending(false),
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
@@ -876,14 +1043,17 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     // write buffer size because all the data needs to be copied to
     // the write buffer for the purpose of masking. A 16KB buffer
     // appears to be a good compromise to reduce the number of socket
-    // write calls and not consume too much memory.
+    // write calls and not consume too much memory. Both buffers grow
+    // up to 64KB when larger messages are exchanged.
     //
 }
 
-IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, const TransceiverPtr& del) :
+IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, const TransceiverPtr& del,
+                                          const WSDeflateConfig& deflate) :
     _instance(instance),
     _delegate(del),
     _incoming(true),
+    _deflate(deflate),
     _state(StateInitializeDelegate),
     _parser(new HttpParser),
     _readState(ReadStateOpcode),
@@ -892,20 +1062,43 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readOpCode(0),
     _readHeaderLength(0),
     _readPayloadLength(0),
+    _readCompressed(false),
+    _readFramePos(0),
     _writeState(WriteStateHeader),
     _writeBufferSize(1024),
+    _writePayloadLength(0),
+    _writeCompressed(false),
+    _deflateStream(0),
+    _inflateStream(0),
+    _deflateNoContextTakeover(false),
+    _inflatePos(0),
+    _inflateOutputPending(false),
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
     _closingReason(CLOSURE_NORMAL)
 {
     //
-    // Use 1KB read and write buffer sizes.
+    // Use 1KB read and write buffer sizes. The read buffer grows up
+    // to 64KB when reads fill it, the write buffer only holds the frame
+    // header and small messages.
     //
 }
 
 IceInternal::WSTransceiver::~WSTransceiver()
 {
+#ifdef ICE_HAS_ZLIB
+    if(_deflateStream)
+    {
+        deflateEnd(_deflateStream);
+        delete _deflateStream;
+    }
+    if(_inflateStream)
+    {
+        inflateEnd(_inflateStream);
+        delete _inflateStream;
+    }
+#endif
 }
 
 void
@@ -1003,6 +1196,85 @@ IceInternal::WSTransceiver::handleRequest(Buffer& responseBuffer)
     //
     const_cast<string&>(_resource) = _parser->uri();
 
+    //
+    // If permessage-deflate is enabled, accept the first permessage-deflate offer
+    // (RFC 7692) with parameters we can honor. Other extensions are ignored.
+    //
+    string extension;
+    if(_deflate.enabled && _parser->getHeader("Sec-WebSocket-Extensions", val, true))
+    {
+        vector<string> offers;
+        IceUtilInternal::splitString(val, ",", offers);
+        for(vector<string>::const_iterator p = offers.begin(); p != offers.end() && extension.empty(); ++p)
+        {
+            map<string, string> params;
+            if(!parseDeflateExtension(*p, params))
+            {
+                continue;
+            }
+
+            int windowBits = _deflate.windowBits;
+            bool noContextTakeover = _deflate.noContextTakeover;
+            bool clientNoContextTakeover = false;
+            bool maxWindowBits = false;
+            bool valid = true;
+            for(map<string, string>::const_iterator q = params.begin(); q != params.end() && valid; ++q)
+            {
+                int bits;
+                if(q->first == "server_no_context_takeover" && q->second.empty())
+                {
+                    noContextTakeover = true;
+                }
+                else if(q->first == "client_no_context_takeover" && q->second.empty())
+                {
+                    //
+                    // Accepted and echoed in the response, the client resets its
+                    // compression context after each message.
+                    //
+                    clientNoContextTakeover = true;
+                }
+                else if(q->first == "server_max_window_bits")
+                {
+                    //
+                    // zlib doesn't support deflating with a window of 8 bits, decline
+                    // the offer in this case.
+                    //
+                    valid = parseWindowBits(q->second, bits) && bits > 8;
+                    windowBits = min(windowBits, bits);
+                    maxWindowBits = true;
+                }
+                else if(q->first == "client_max_window_bits")
+                {
+                    valid = q->second.empty() || parseWindowBits(q->second, bits);
+                }
+                else
+                {
+                    valid = false;
+                }
+            }
+
+            if(valid)
+            {
+                ostringstream os;
+                os << "permessage-deflate";
+                if(noContextTakeover)
+                {
+                    os << "; server_no_context_takeover";
+                }
+                if(clientNoContextTakeover)
+                {
+                    os << "; client_no_context_takeover";
+                }
+                if(maxWindowBits)
+                {
+                    os << "; server_max_window_bits=" << windowBits;
+                }
+                extension = os.str();
+                initDeflate(windowBits, noContextTakeover);
+            }
+        }
+    }
+
     //
     // Compose the response.
     //
@@ -1014,6 +1286,10 @@ IceInternal::WSTransceiver::handleRequest(Buffer& responseBuffer)
     {
         out << "Sec-WebSocket-Protocol: " << _iceProtocol << "\r\n";
     }
+    if(!extension.empty())
+    {
+        out << "Sec-WebSocket-Extensions: " << extension << "\r\n";
+    }
 
     //
     // The response includes:
@@ -1131,6 +1407,191 @@ IceInternal::WSTransceiver::handleResponse()
     {
         throw WebSocketException("invalid value `" + val + "' for Sec-WebSocket-Accept");
     }
+
+    //
+    // The server can only accept the permessage-deflate extension if we offered
+    // it. Use a smaller window and reset the compression context if it asks for
+    // it.
+    //
+    if(_parser->getHeader("Sec-WebSocket-Extensions", val, true))
+    {
+        map<string, string> params;
+        if(!_deflate.enabled || !parseDeflateExtension(val, params))
+        {
+            throw WebSocketException("invalid value `" + val + "' for Sec-WebSocket-Extensions");
+        }
+
+        int windowBits = _deflate.windowBits;
+        bool noContextTakeover = _deflate.noContextTakeover;
+        for(map<string, string>::const_iterator p = params.begin(); p != params.end(); ++p)
+        {
+            int bits;
+            if(p->first == "server_no_context_takeover" && p->second.empty())
+            {
+                // Nothing to do, the server's context takeover doesn't matter for inflating.
+            }
+            else if(p->first == "client_no_context_takeover" && p->second.empty())
+            {
+                noContextTakeover = true;
+            }
+            else if(p->first == "server_max_window_bits" && parseWindowBits(p->second, bits))
+            {
+                // Nothing to do, we inflate with the largest window.
+            }
+            else if(p->first == "client_max_window_bits" && parseWindowBits(p->second, bits) && bits > 8)
+            {
+                windowBits = min(windowBits, bits);
+            }
+            else
+            {
+                throw WebSocketException("invalid value `" + val + "' for Sec-WebSocket-Extensions");
+            }
+        }
+        initDeflate(windowBits, noContextTakeover);
+    }
+}
+
+void
+IceInternal::WSTransceiver::initDeflate(int windowBits, bool noContextTakeover)
+{
+#ifdef ICE_HAS_ZLIB
+    int level = _instance->properties()->getPropertyAsIntWithDefault("Ice.Compression.Level", 1);
+    if(level < 1)
+    {
+        level = 1;
+    }
+    else if(level > 9)
+    {
+        level = 9;
+    }
+
+    //
+    // The permessage-deflate payload is a raw deflate stream, hence the negative
+    // window bits. We inflate with the largest window since the peer is free to
+    // use any window size unless we ask for a smaller one.
+    //
+    _deflateStream = new z_stream();
+    if(deflateInit2(_deflateStream, level, Z_DEFLATED, -windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        delete _deflateStream;
+        _deflateStream = 0;
+        throw WebSocketException("unable to initialize permessage-deflate compression");
+    }
+    _inflateStream = new z_stream();
+    if(inflateInit2(_inflateStream, -15) != Z_OK)
+    {
+        delete _inflateStream;
+        _inflateStream = 0;
+        throw WebSocketException("unable to initialize permessage-deflate decompression");
+    }
+    _deflateNoContextTakeover = noContextTakeover;
+#else
+    assert(false); // permessage-deflate can't be enabled without zlib.
+#endif
+}
+
+bool
+IceInternal::WSTransceiver::inflatePending() const
+{
+    return _inflatePos < _inflateInput.size() || _inflateOutputPending;
+}
+
+void
+IceInternal::WSTransceiver::inflateMessage(Buffer& buf)
+{
+#ifdef ICE_HAS_ZLIB
+    assert(_inflateStream && buf.i < buf.b.end());
+    _inflateStream->next_in = _inflateInput.empty() ? 0 : &_inflateInput[_inflatePos];
+    _inflateStream->avail_in = static_cast<uInt>(_inflateInput.size() - _inflatePos);
+    _inflateStream->next_out = buf.i;
+    _inflateStream->avail_out = static_cast<uInt>(buf.b.end() - buf.i);
+    while(true)
+    {
+        int rc = inflate(_inflateStream, Z_SYNC_FLUSH);
+        if(rc == Z_STREAM_END)
+        {
+            //
+            // The peer terminated the deflate stream with a final block, the next
+            // messages start a new stream.
+            //
+            inflateReset(_inflateStream);
+            if(_inflateStream->avail_in > 0 && _inflateStream->avail_out > 0)
+            {
+                continue;
+            }
+        }
+        else if(rc != Z_OK && rc != Z_BUF_ERROR)
+        {
+            throw ProtocolException(__FILE__, __LINE__, "invalid compressed WebSocket payload");
+        }
+        break;
+    }
+    buf.i = _inflateStream->next_out;
+    _inflatePos = _inflateInput.size() - _inflateStream->avail_in;
+    _inflateOutputPending = _inflateStream->avail_out == 0;
+    if(_inflatePos == _inflateInput.size())
+    {
+        _inflateInput.clear();
+        _inflatePos = 0;
+    }
+#else
+    assert(false); // permessage-deflate can't be enabled without zlib.
+#endif
+}
+
+bool
+IceInternal::WSTransceiver::deflateMessage(const Buffer& buf)
+{
+#ifdef ICE_HAS_ZLIB
+    assert(_deflateStream);
+    _deflateStream->next_in = const_cast<Bytef*>(&buf.b[0]);
+    _deflateStream->avail_in = static_cast<uInt>(buf.b.size());
+    _deflateBuffer.b.resize(deflateBound(_deflateStream, static_cast<uLong>(buf.b.size())) + 16);
+    size_t pos = 0;
+    while(true)
+    {
+        _deflateStream->next_out = &_deflateBuffer.b[pos];
+        _deflateStream->avail_out = static_cast<uInt>(_deflateBuffer.b.size() - pos);
+        if(deflate(_deflateStream, Z_SYNC_FLUSH) == Z_STREAM_ERROR)
+        {
+            throw ProtocolException(__FILE__, __LINE__, "permessage-deflate compression failure");
+        }
+        pos = _deflateBuffer.b.size() - _deflateStream->avail_out;
+        if(_deflateStream->avail_out > 0)
+        {
+            break;
+        }
+        _deflateBuffer.b.resize(_deflateBuffer.b.size() * 2);
+    }
+
+    //
+    // Remove the 0x00 0x00 0xff 0xff tail of the sync flush, the receiver adds
+    // it back (RFC 7692, section 7.2.1).
+    //
+    assert(pos >= 4);
+    pos -= 4;
+
+    if(_deflateNoContextTakeover)
+    {
+        deflateReset(_deflateStream);
+
+        //
+        // Without context takeover, the peer doesn't need to see this message
+        // to inflate the next ones, send it uncompressed if it doesn't compress.
+        //
+        if(pos >= buf.b.size())
+        {
+            return false;
+        }
+    }
+
+    _deflateBuffer.b.resize(pos);
+    _deflateBuffer.i = _deflateBuffer.b.begin();
+    return true;
+#else
+    assert(false); // permessage-deflate can't be enabled without zlib.
+    return false;
+#endif
 }
 
 bool
@@ -1138,6 +1599,23 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
 {
     while(true)
     {
+        //
+        // Inflate the pending compressed data first, it precedes the data of the
+        // next frames.
+        //
+        if(inflatePending())
+        {
+            if(!buf.b.empty() && buf.i != buf.b.end())
+            {
+                inflateMessage(buf);
+            }
+            if(buf.b.empty() || buf.i == buf.b.end())
+            {
+                _readStart = _readBuffer.i;
+                return false;
+            }
+        }
+
         if(_readState == ReadStateOpcode)
         {
             //
@@ -1156,6 +1634,15 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
             unsigned char ch = static_cast<unsigned char>(*_readI++);
             _readOpCode = ch & 0xf;
 
+            //
+            // RSV1 is only valid on the first frame of a data message if
+            // permessage-deflate was negotiated.
+            //
+            if((ch & FLAG_COMPRESSED) == FLAG_COMPRESSED && (_readOpCode != OP_DATA || !_inflateStream))
+            {
+                throw ProtocolException(__FILE__, __LINE__, "invalid RSV1 bit");
+            }
+
             //
             // Remember if last frame if we're going to read a data or
             // continuation frame, this is only for protocol
@@ -1168,6 +1655,7 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                     throw ProtocolException(__FILE__, __LINE__, "invalid data frame, no FIN on previous frame");
                 }
                 _readLastFrame = (ch & FLAG_FINAL) == FLAG_FINAL;
+                _readCompressed = (ch & FLAG_COMPRESSED) == FLAG_COMPRESSED;
             }
             else if(_readOpCode == OP_CONT)
             {
@@ -1269,7 +1757,8 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                 if(_instance->traceLevel() >= 2)
                 {
                     Trace out(_instance->logger(), _instance->traceCategory());
-                    out << "received " << protocol() << (_readOpCode == OP_DATA ? " data" : " continuation");
+                    out << "received " << protocol() << (_readCompressed ? " compressed" : "");
+                    out << (_readOpCode == OP_DATA ? " data" : " continuation");
                     out << " frame with payload length of " << _readPayloadLength;
                     out << " bytes\n" << toString();
                 }
@@ -1278,9 +1767,10 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                 {
                     throw ProtocolException(__FILE__, __LINE__, "payload length is 0");
                 }
-                _readState = ReadStatePayload;
+                _readState = _readCompressed ? ReadStateCompressedPayload : ReadStatePayload;
                 assert(buf.i != buf.b.end());
                 _readFrameStart = buf.i;
+                _readFramePos = 0;
                 break;
             }
             case OP_CLOSE: // Connection close
@@ -1383,6 +1873,44 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
             _readState = ReadStateOpcode;
         }
 
+        if(_readState == ReadStateCompressedPayload)
+        {
+            //
+            // The compressed payload is read in the read buffer, it's unmasked and
+            // queued for inflating at the start of the next iteration.
+            //
+            if(!readBuffered(1))
+            {
+                return true;
+            }
+
+            size_t n = min(static_cast<size_t>(_readBuffer.i - _readI), _readPayloadLength);
+            size_t pos = _inflateInput.size();
+            _inflateInput.insert(_inflateInput.end(), _readI, _readI + n);
+            if(_incoming)
+            {
+                applyMask(&_inflateInput[pos], &_inflateInput[pos], n, _readMask, _readFramePos);
+            }
+            _readI += n;
+            _readFramePos += n;
+            _readPayloadLength -= n;
+
+            if(_readPayloadLength == 0)
+            {
+                if(_readLastFrame)
+                {
+                    //
+                    // Add back the 0x00 0x00 0xff 0xff tail removed by the sender
+                    // (RFC 7692, section 7.2.2).
+                    //
+                    static const Byte tail[] = { 0x00, 0x00, 0xff, 0xff };
+                    _inflateInput.insert(_inflateInput.end(), tail, tail + sizeof(tail));
+                }
+                _readState = ReadStateOpcode;
+            }
+            continue;
+        }
+
         if(_readState == ReadStatePayload)
         {
             //
@@ -1436,11 +1964,7 @@ IceInternal::WSTransceiver::postRead(Buffer& buf)
         //
         // Unmask the data we just read.
         //
-        IceInternal::Buffer::Container::iterator p = _readStart;
-        for(size_t n = _readStart - _readFrameStart; p < buf.i; ++p, ++n)
-        {
-            *p ^= _readMask[n % 4];
-        }
+        applyMask(_readStart, _readStart, buf.i - _readStart, _readMask, _readStart - _readFrameStart);
     }
 
     _readPayloadLength -= buf.i - _readStart;
@@ -1468,7 +1992,12 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
             }
 
             assert(buf.i = buf.b.begin());
-            prepareWriteHeader(OP_DATA, buf.b.size());
+            _writeCompressed = _deflateStream && buf.b.size() >= deflateMinSize && deflateMessage(buf);
+            prepareWriteHeader(OP_DATA, _writeCompressed ? _deflateBuffer.b.size() : buf.b.size());
+            if(_writeCompressed)
+            {
+                _writeBuffer.b[0] |= FLAG_COMPRESSED;
+            }
 
             _writeState = WriteStatePayload;
         }
@@ -1532,11 +2061,12 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
         //
         // For an outgoing connection, each message must be masked with a random
         // 32-bit value, so we copy the entire message into the internal buffer
-        // for writing. For incoming connections, we just copy the start of the
-        // message in the internal buffer after the hedaer. If the message is
-        // larger, the reminder is sent directly from the message buffer to avoid
-        // copying.
+        // for writing. For incoming connections, we copy the message in the
+        // internal buffer after the header only if it fits. If the message is
+        // larger, it's sent directly from the message buffer to avoid copying.
+        // Compressed messages are sent from the deflate buffer.
         //
+        Buffer& payload = _writeCompressed ? _deflateBuffer : buf;
 
         if(!_incoming && (_writePayloadLength == 0 || _writeBuffer.i == _writeBuffer.b.end()))
         {
@@ -1545,11 +2075,11 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
                 _writeBuffer.i = _writeBuffer.b.begin();
             }
 
-            size_t n = buf.i - buf.b.begin();
-            for(; n < buf.b.size() && _writeBuffer.i < _writeBuffer.b.end(); ++_writeBuffer.i, ++n)
-            {
-                *_writeBuffer.i = buf.b[n] ^ _writeMask[n % 4];
-            }
+            size_t n = payload.i - payload.b.begin();
+            size_t sz = min(payload.b.size() - n, static_cast<size_t>(_writeBuffer.b.end() - _writeBuffer.i));
+            applyMask(_writeBuffer.i, &payload.b[n], sz, _writeMask, n);
+            _writeBuffer.i += sz;
+            n += sz;
             _writePayloadLength = n;
             if(_writeBuffer.i < _writeBuffer.b.end())
             {
@@ -1559,15 +2089,15 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
         }
         else if(_writePayloadLength == 0)
         {
-            size_t n = min(_writeBuffer.b.end() - _writeBuffer.i, buf.b.end() - buf.i);
-            memcpy(_writeBuffer.i, buf.i, n);
-            _writeBuffer.i += n;
-            buf.i += n;
-            _writePayloadLength = n;
-            if(_writeBuffer.i < _writeBuffer.b.end())
+            size_t n = payload.b.end() - payload.i;
+            if(n <= static_cast<size_t>(_writeBuffer.b.end() - _writeBuffer.i))
             {
-                _writeBuffer.b.resize(_writeBuffer.i - _writeBuffer.b.begin());
+                memcpy(_writeBuffer.i, payload.i, n);
+                _writeBuffer.i += n;
+                payload.i += n;
             }
+            _writePayloadLength = n;
+            _writeBuffer.b.resize(_writeBuffer.i - _writeBuffer.b.begin());
             _writeBuffer.i = _writeBuffer.b.begin();
         }
         return true;
@@ -1636,14 +2166,24 @@ IceInternal::WSTransceiver::postWrite(Buffer& buf)
         }
     }
 
-    if((!_incoming || buf.i == buf.b.begin()) && _writePayloadLength > 0)
+    Buffer& payload = _writeCompressed ? _deflateBuffer : buf;
+    if(!_incoming && _writePayloadLength > 0)
     {
         if(_writeBuffer.i == _writeBuffer.b.end())
         {
-            buf.i = buf.b.begin() + _writePayloadLength;
+            payload.i = payload.b.begin() + _writePayloadLength;
         }
     }
 
+    if(_writeCompressed && payload.i == payload.b.end())
+    {
+        //
+        // The compressed message is sent, the message buffer is fully written.
+        //
+        buf.i = buf.b.end();
+        _writeCompressed = false;
+    }
+
     if(buf.b.empty() || buf.i == buf.b.end())
     {
         _writeState = WriteStateHeader;
@@ -1697,6 +2237,15 @@ IceInternal::WSTransceiver::readBuffered(IceInternal::Buffer::Container::size_ty
 void
 IceInternal::WSTransceiver::prepareWriteHeader(Byte opCode, IceInternal::Buffer::Container::size_type payloadLength)
 {
+    //
+    // All the payload of an outgoing connection is copied to the write buffer
+    // for masking, grow the buffer to write large messages with fewer calls.
+    //
+    if(!_incoming && opCode == OP_DATA && _writeBufferSize < maxBufferSize && payloadLength + 14 > _writeBufferSize)
+    {
+        _writeBufferSize = min(payloadLength + 14, maxBufferSize); // 14 bytes for the largest header.
+    }
+
     //
     // We need to prepare the frame header.
     //
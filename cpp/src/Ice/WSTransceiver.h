@@ -17,6 +17,9 @@
 #include <Ice/Transceiver.h>
 #include <Ice/Network.h>
 #include <Ice/Buffer.h>
+#include <Ice/WSEndpoint.h>
+
+struct z_stream_s;
 
 namespace IceInternal
 {
@@ -53,13 +56,19 @@ public:
 
 private:
 
-    WSTransceiver(const ProtocolInstancePtr&, const TransceiverPtr&, const std::string&, const std::string&);
-    WSTransceiver(const ProtocolInstancePtr&, const TransceiverPtr&);
+    WSTransceiver(const ProtocolInstancePtr&, const TransceiverPtr&, const std::string&, const std::string&,
+                  const WSDeflateConfig&);
+    WSTransceiver(const ProtocolInstancePtr&, const TransceiverPtr&, const WSDeflateConfig&);
     virtual ~WSTransceiver();
 
     void handleRequest(Buffer&);
     void handleResponse();
 
+    void initDeflate(int, bool);
+    bool inflatePending() const;
+    void inflateMessage(Buffer&);
+    bool deflateMessage(const Buffer&);
+
     bool preRead(Buffer&);
     bool postRead(Buffer&);
 
@@ -77,6 +86,7 @@ private:
     const std::string _host;
     const std::string _resource;
     const bool _incoming;
+    const WSDeflateConfig _deflate;
 
     enum State
     {
@@ -104,12 +114,13 @@ private:
         ReadStateHeader,
         ReadStateControlFrame,
         ReadStatePayload,
+        ReadStateCompressedPayload,
     };
 
     ReadState _readState;
     Buffer _readBuffer;
     Buffer::Container::iterator _readI;
-    const Buffer::Container::size_type _readBufferSize;
+    Buffer::Container::size_type _readBufferSize;
 
     bool _readLastFrame;
     int _readOpCode;
@@ -118,6 +129,8 @@ private:
     Buffer::Container::iterator _readStart;
     Buffer::Container::iterator _readFrameStart;
     unsigned char _readMask[4];
+    bool _readCompressed;
+    size_t _readFramePos;
 
     enum WriteState
     {
@@ -128,9 +141,22 @@ private:
 
     WriteState _writeState;
     Buffer _writeBuffer;
-    const Buffer::Container::size_type _writeBufferSize;
+    Buffer::Container::size_type _writeBufferSize;
     unsigned char _writeMask[4];
     size_t _writePayloadLength;
+    bool _writeCompressed;
+
+    //
+    // The permessage-deflate streams, they are only allocated if the
+    // extension is negotiated during the HTTP upgrade.
+    //
+    z_stream_s* _deflateStream;
+    z_stream_s* _inflateStream;
+    bool _deflateNoContextTakeover;
+    Buffer _deflateBuffer;
+    std::vector<Ice::Byte> _inflateInput;
+    size_t _inflatePos;
+    bool _inflateOutputPending;
 
     bool _readPending;
     bool _writePending;
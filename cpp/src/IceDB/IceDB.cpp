@@ -12,6 +12,8 @@
 
 #include <lmdb.h>
 
+#include <algorithm>
+
 using namespace IceDB;
 using namespace std;
 
@@ -227,9 +229,9 @@ Env::menv() const
     return _menv;
 }
 
-Txn::Txn(const Env& env, unsigned int flags)
+Txn::Txn(const Env& env, unsigned int flags, MDB_txn* parent)
 {
-    const int rc = mdb_txn_begin(env.menv(), 0, flags, &_mtxn);
+    const int rc = mdb_txn_begin(env.menv(), parent, flags, &_mtxn);
     if(rc != MDB_SUCCESS)
     {
         throw LMDBException(__FILE__, __LINE__, rc);
@@ -304,6 +306,11 @@ ReadWriteTxn::ReadWriteTxn(const Env& env) :
 {
 }
 
+ReadWriteTxn::ReadWriteTxn(const Env& env, const ReadWriteTxn& parent) :
+    Txn(env, 0, parent.mtxn())
+{
+}
+
 DbiBase::DbiBase(const Txn& txn, const std::string& name, unsigned int flags, MDB_cmp_func* cmp)
 {
     int rc = mdb_dbi_open(txn.mtxn(), name.c_str(), flags, &_mdbi);
@@ -485,6 +492,174 @@ CursorBase::renew(const ReadOnlyTxn& txn)
     }
 }
 
+GroupWrite::~GroupWrite()
+{
+    // Out of line to avoid weak vtable
+}
+
+GroupCommit::GroupCommit(const Env& env, const IceUtil::Time& maxLatency, size_t maxWrites) :
+    _env(env),
+    _maxLatency(maxLatency),
+    _maxWrites(maxWrites > 0 ? maxWrites : static_cast<size_t>(-1)),
+    _committing(false)
+{
+}
+
+GroupCommit::~GroupCommit()
+{
+    assert(_queue.empty());
+}
+
+void
+GroupCommit::write(GroupWrite& write)
+{
+    Request request = { &write, false, MDB_SUCCESS };
+
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+    _queue.push_back(&request);
+    if(_committing && _queue.size() >= _maxWrites)
+    {
+        _monitor.notifyAll(); // Wake up the thread waiting to fill the next batch.
+    }
+
+    while(!request.done)
+    {
+        if(_committing)
+        {
+            _monitor.wait();
+            continue;
+        }
+
+        //
+        // No batch is being committed, this thread commits the next
+        // batch once it's full or the maximum latency is reached.
+        //
+        _committing = true;
+        if(_maxLatency > IceUtil::Time())
+        {
+            IceUtil::Time timeout = IceUtil::Time::now(IceUtil::Time::Monotonic) + _maxLatency;
+            while(_queue.size() < _maxWrites)
+            {
+                IceUtil::Time delay = timeout - IceUtil::Time::now(IceUtil::Time::Monotonic);
+                if(delay <= IceUtil::Time())
+                {
+                    break;
+                }
+                _monitor.timedWait(delay);
+            }
+        }
+
+        vector<Request*> batch;
+        if(_queue.size() > _maxWrites)
+        {
+            batch.assign(_queue.begin(), _queue.begin() + _maxWrites);
+            _queue.erase(_queue.begin(), _queue.begin() + _maxWrites);
+        }
+        else
+        {
+            batch.swap(_queue);
+        }
+
+        vector<GroupWrite*> writes;
+        for(vector<Request*>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            writes.push_back((*p)->write);
+        }
+
+        int error = MDB_PANIC;
+        sync.release();
+        try
+        {
+            commit(writes, error);
+        }
+        catch(...)
+        {
+            //
+            // A completed callback raised, the batch status is the status
+            // of its transaction. Release the writers of the batch and
+            // propagate the exception, the write of this thread is
+            // withdrawn if it's not in the batch.
+            //
+            sync.acquire();
+            finished(batch, error);
+            if(!request.done)
+            {
+                _queue.erase(find(_queue.begin(), _queue.end(), &request));
+            }
+            throw;
+        }
+        sync.acquire();
+        finished(batch, error);
+    }
+
+    if(request.error != MDB_SUCCESS)
+    {
+        throw LMDBException(__FILE__, __LINE__, request.error);
+    }
+}
+
+void
+GroupCommit::commit(const vector<GroupWrite*>& writes, int& error)
+{
+    error = MDB_SUCCESS;
+    try
+    {
+        ReadWriteTxn txn(_env);
+        for(vector<GroupWrite*>::const_iterator p = writes.begin(); p != writes.end(); ++p)
+        {
+            //
+            // Each write is executed in a nested transaction to roll
+            // it back without affecting the other writes of the batch.
+            //
+            ReadWriteTxn nested(_env, txn);
+            bool executed = false;
+            try
+            {
+                executed = (*p)->execute(nested);
+            }
+            catch(...)
+            {
+            }
+
+            if(executed)
+            {
+                nested.commit();
+            }
+        }
+        txn.commit();
+    }
+    catch(const LMDBException& ex)
+    {
+        error = ex.error();
+    }
+    catch(...)
+    {
+        error = MDB_PANIC;
+    }
+
+    //
+    // The callbacks are called outside the try block, their exceptions
+    // aren't failures of the batch transaction.
+    //
+    for(vector<GroupWrite*>::const_iterator p = writes.begin(); p != writes.end(); ++p)
+    {
+        (*p)->completed(error == MDB_SUCCESS);
+    }
+}
+
+void
+GroupCommit::finished(const vector<Request*>& batch, int error)
+{
+    // Must be called with _monitor locked.
+    for(vector<Request*>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+    {
+        (*p)->error = error;
+        (*p)->done = true;
+    }
+    _committing = false;
+    _monitor.notifyAll();
+}
+
 //
 // On Windows, we use a default LMDB map size of 10MB, whereas on other platforms
 // (Linux, macOS), we use a default of 100MB.
@@ -12,6 +12,9 @@
 
 #include <IceUtil/Exception.h>
 #include <IceUtil/FileUtil.h>
+#include <IceUtil/Monitor.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
 #include <Ice/Initialize.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
@@ -147,6 +150,63 @@ private:
 template<typename T, typename C, typename H>
 struct Codec;
 
+//
+// View references a marshaled key or data in the memory mapped by LMDB
+// and decodes it on demand with Codec::read. A view is only valid until
+// the transaction it was read with ends or, for a read-write
+// transaction, until the next update.
+//
+template<typename T, typename C, typename H>
+class View
+{
+public:
+
+    View() :
+        _marshalingContext()
+    {
+        _mval.mv_size = 0;
+        _mval.mv_data = 0;
+    }
+
+    View(const MDB_val& mval, const C& ctx) :
+        _mval(mval),
+        _marshalingContext(ctx)
+    {
+    }
+
+    void read(T& t) const
+    {
+        Codec<T, C, H>::read(t, _mval, _marshalingContext);
+    }
+
+    T value() const
+    {
+        T t;
+        read(t);
+        return t;
+    }
+
+    const unsigned char* data() const
+    {
+        return static_cast<const unsigned char*>(_mval.mv_data);
+    }
+
+    size_t size() const
+    {
+        return _mval.mv_size;
+    }
+
+    const MDB_val& mval() const
+    {
+        return _mval;
+    }
+
+private:
+
+    MDB_val _mval;
+    C _marshalingContext;
+};
+
 class ICE_DB_API Env
 {
 public:
@@ -180,7 +240,7 @@ public:
 
 protected:
 
-    explicit Txn(const Env&, unsigned int);
+    explicit Txn(const Env&, unsigned int, MDB_txn* = 0);
 
     MDB_txn* _mtxn;
 
@@ -210,6 +270,11 @@ public:
     virtual ~ReadWriteTxn();
 
     explicit ReadWriteTxn(const Env&);
+
+    //
+    // Begins a transaction nested in the given read-write transaction.
+    //
+    ReadWriteTxn(const Env&, const ReadWriteTxn&);
 };
 
 class ICE_DB_API DbiBase
@@ -270,6 +335,23 @@ public:
         return false;
     }
 
+    bool get(const Txn& txn, const K& key, View<D, C, H>& data) const
+    {
+        unsigned char kbuf[maxKeySize];
+        MDB_val mkey = {maxKeySize, kbuf};
+
+        if(Codec<K, C, H>::write(key, mkey, _marshalingContext))
+        {
+            MDB_val mdata;
+            if(DbiBase::get(txn, &mkey, &mdata))
+            {
+                data = View<D, C, H>(mdata, _marshalingContext);
+                return true;
+            }
+        }
+        return false;
+    }
+
     void put(const ReadWriteTxn& txn, const K& key, const D& data, unsigned int flags = 0)
     {
         unsigned char kbuf[maxKeySize];
@@ -409,6 +491,18 @@ public:
         return false;
     }
 
+    bool get(View<K, C, H>& key, View<D, C, H>& data, MDB_cursor_op op)
+    {
+        MDB_val mkey, mdata;
+        if(CursorBase::get(&mkey, &mdata, op))
+        {
+            key = View<K, C, H>(mkey, _marshalingContext);
+            data = View<D, C, H>(mdata, _marshalingContext);
+            return true;
+        }
+        return false;
+    }
+
     bool find(const K& key)
     {
         unsigned char kbuf[maxKeySize];
@@ -493,6 +587,89 @@ public:
     }
 };
 
+//
+// CursorIterator is an input iterator over the records of a cursor. It
+// returns the keys and data as views and doesn't decode or allocate
+// anything when advancing, records are decoded only if needed. Advancing
+// the iterator moves the cursor.
+//
+template<typename K, typename D, typename C, typename H>
+class CursorIterator
+{
+public:
+
+    typedef std::input_iterator_tag iterator_category;
+    typedef std::pair<View<K, C, H>, View<D, C, H> > value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const value_type* pointer;
+    typedef const value_type& reference;
+
+    //
+    // Constructs the end iterator.
+    //
+    CursorIterator() :
+        _cursor(0)
+    {
+    }
+
+    //
+    // Positions the cursor with the given operation, MDB_NEXT iterates
+    // from the cursor's current position (or the first record if the
+    // cursor isn't positioned yet).
+    //
+    explicit CursorIterator(Cursor<K, D, C, H>& cursor, MDB_cursor_op op = MDB_FIRST) :
+        _cursor(&cursor)
+    {
+        advance(op);
+    }
+
+    reference operator*() const
+    {
+        return _record;
+    }
+
+    pointer operator->() const
+    {
+        return &_record;
+    }
+
+    CursorIterator& operator++()
+    {
+        advance(MDB_NEXT);
+        return *this;
+    }
+
+    CursorIterator operator++(int)
+    {
+        CursorIterator tmp = *this;
+        advance(MDB_NEXT);
+        return tmp;
+    }
+
+    bool operator==(const CursorIterator& rhs) const
+    {
+        return _cursor == rhs._cursor;
+    }
+
+    bool operator!=(const CursorIterator& rhs) const
+    {
+        return _cursor != rhs._cursor;
+    }
+
+private:
+
+    void advance(MDB_cursor_op op)
+    {
+        if(!_cursor->get(_record.first, _record.second, op))
+        {
+            _cursor = 0;
+        }
+    }
+
+    Cursor<K, D, C, H>* _cursor;
+    value_type _record;
+};
+
 //
 // Partial specialization of Codec for Ice encoding
 //
@@ -533,6 +710,87 @@ struct Codec<T, IceContext, Ice::OutputStream>
     }
 };
 
+//
+// GroupWrite is a logical update submitted to a GroupCommit.
+//
+class ICE_DB_API GroupWrite
+{
+public:
+
+    virtual ~GroupWrite();
+
+    //
+    // Performs the update with a transaction nested in the batch
+    // transaction. The update is rolled back if execute returns false
+    // or raises an exception.
+    //
+    virtual bool execute(const ReadWriteTxn&) = 0;
+
+    //
+    // Called in submission order once the batch transaction is
+    // committed (true) or failed to commit (false).
+    //
+    virtual void completed(bool) = 0;
+};
+
+//
+// GroupCommit coalesces the writes submitted concurrently by several
+// threads into a single read-write transaction, so that they share the
+// cost of the commit. The first thread to submit a write while no
+// batch is being committed waits up to maxLatency for more writes (or
+// until maxWrites writes are queued) and commits the batch on behalf
+// of the other threads. A maxWrites of 0 doesn't limit the batch size.
+//
+class ICE_DB_API GroupCommit
+{
+public:
+
+    explicit GroupCommit(const Env&, const IceUtil::Time& = IceUtil::Time(), size_t = 0);
+    virtual ~GroupCommit();
+
+    //
+    // Executes the write with the next batch and returns once the
+    // batch is committed. Raises LMDBException if the batch
+    // transaction fails.
+    //
+    void write(GroupWrite&);
+
+protected:
+
+    //
+    // Executes the writes of a batch, commits the batch transaction and
+    // calls the completed callbacks. The status of the transaction is
+    // returned with the int parameter, the exceptions raised by the
+    // callbacks are propagated. Subclasses can override it to serialize
+    // batches with the other writers of the environment and must call
+    // the base implementation.
+    //
+    virtual void commit(const std::vector<GroupWrite*>&, int&);
+
+private:
+
+    // Not implemented: class is not copyable
+    GroupCommit(const GroupCommit&);
+    void operator=(const GroupCommit&);
+
+    struct Request
+    {
+        GroupWrite* write;
+        bool done;
+        int error;
+    };
+
+    void finished(const std::vector<Request*>&, int);
+
+    const Env& _env;
+    const IceUtil::Time _maxLatency;
+    const size_t _maxWrites;
+
+    IceUtil::Monitor<IceUtil::Mutex> _monitor;
+    std::vector<Request*> _queue;
+    bool _committing;
+};
+
 //
 // Returns computed mapSize in bytes.
 // When the input parameter is <= 0, returns a platform-dependent default
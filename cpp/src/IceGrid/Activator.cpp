@@ -28,6 +28,19 @@
 #   include <sys/wait.h>
 #   include <signal.h>
 #   include <pwd.h> // for getpwuid
+#   include <unistd.h>
+#   if defined(__linux)
+#       include <sys/epoll.h>
+#       include <sys/syscall.h>
+#   else
+#       include <poll.h>
+#   endif
+#   if defined(__APPLE__)
+#       include <crt_externs.h>
+#       define environ (*_NSGetEnviron())
+#   else
+extern char** environ;
+#   endif
 #else
 #ifndef SIGKILL
 #   define SIGKILL 9
@@ -73,39 +86,313 @@ private:
 };
 
 #ifndef _WIN32
+
+namespace
+{
+
+//
+// The steps of the server process setup which can fail, the child
+// process reports the failed step and the error number to the node
+// over the error message pipe.
+//
+enum ChildStep
+{
+    SetGroupIdStep,
+    SetGroupsStep,
+    SetUserIdStep,
+    ChangeDirectoryStep,
+    ExecuteStep
+};
+
+struct ChildArgs
+{
+    uid_t uid;
+    gid_t gid;
+    bool setGroups;
+    const gid_t* groups;
+    size_t ngroups;
+    const char* pwd;
+    char** argv;
+    char** envp;
+    char** shArgv;
+    const char* searchPath;
+    char* pathBuf;
+    size_t pathBufSize;
+    int pipeFd;
+    int errorFd;
+    int maxFd;
+    const sigset_t* sigmask;
+};
+
 //
 // Helper function for async-signal safe error reporting
 //
 void
-reportChildError(int err, int fd, const char* cannot, const char* name, const TraceLevelsPtr& traceLevels)
+reportChildError(int fd, ChildStep step, int err)
 {
     //
-    // Send any errors to the parent process, using the write
-    // end of the pipe.
+    // Send the error to the parent process, using the write end of
+    // the pipe.
     //
-    char msg[500];
-    strcpy(msg, cannot);
-    strcat(msg, " `");
-    strcat(msg, name);
-    strcat(msg, "'");
-    if(err)
+    int error[2] = { step, err };
+    ssize_t sz = write(fd, error, sizeof(error));
+    (void)sz;
+
+    //
+    // _exit instead of exit to avoid interferences with the parent
+    // process.
+    //
+    _exit(EXIT_FAILURE);
+}
+
+//
+// On Linux, the set*id functions from the C library signal all the
+// threads of the process to change their credentials. The child
+// created with vfork shares the memory of the node and must only
+// change its own credentials with the system calls.
+//
+int
+setGroupId(gid_t gid)
+{
+#if defined(__linux) && defined(SYS_setgid32)
+    return static_cast<int>(syscall(SYS_setgid32, gid));
+#elif defined(__linux)
+    return static_cast<int>(syscall(SYS_setgid, gid));
+#else
+    return setgid(gid);
+#endif
+}
+
+int
+setGroups(size_t ngroups, const gid_t* groups)
+{
+#if defined(__linux) && defined(SYS_setgroups32)
+    return static_cast<int>(syscall(SYS_setgroups32, ngroups, groups));
+#elif defined(__linux)
+    return static_cast<int>(syscall(SYS_setgroups, ngroups, groups));
+#else
+    return setgroups(ngroups, groups);
+#endif
+}
+
+int
+setUserId(uid_t uid)
+{
+#if defined(__linux) && defined(SYS_setuid32)
+    return static_cast<int>(syscall(SYS_setuid32, uid));
+#elif defined(__linux)
+    return static_cast<int>(syscall(SYS_setuid, uid));
+#else
+    return setuid(uid);
+#endif
+}
+
+void
+closeFileDescriptors(int first, int last, int maxFd)
+{
+    if(first > last)
     {
-        strcat(msg, ": ");
-        strcat(msg, strerror(err));
+        return;
     }
-    ssize_t sz = write(fd, msg, strlen(msg));
-    if(sz == -1)
+#if defined(SYS_close_range)
+    if(syscall(SYS_close_range, static_cast<unsigned int>(first), static_cast<unsigned int>(last), 0) == 0)
+    {
+        return;
+    }
+#endif
+    for(int fd = first; fd <= last && fd < maxFd; ++fd)
     {
-        Ice::Warning out(traceLevels->logger);
-        out << "error rerporting child error msg: `" << msg << "'";
+        close(fd);
+    }
+}
+
+void
+execute(const ChildArgs& args)
+{
+    if(!args.searchPath)
+    {
+        execve(args.argv[0], args.argv, args.envp);
+        if(errno == ENOEXEC)
+        {
+            args.shArgv[1] = args.argv[0];
+            execve(args.shArgv[0], args.shArgv, args.envp);
+        }
+        return;
     }
-    close(fd);
 
     //
-    // _exit instead of exit to avoid interferences with the parent
-    // process.
+    // Search the executable like execvp but with the PATH of the server
+    // environment and without allocating memory.
     //
-    _exit(EXIT_FAILURE);
+    bool accessDenied = false;
+    size_t nameLen = strlen(args.argv[0]);
+    const char* p = args.searchPath;
+    while(true)
+    {
+        const char* end = strchr(p, ':');
+        size_t len = end ? static_cast<size_t>(end - p) : strlen(p);
+        if(len + nameLen + 2 <= args.pathBufSize)
+        {
+            char* q = args.pathBuf;
+            if(len == 0)
+            {
+                *q++ = '.';
+            }
+            else
+            {
+                memcpy(q, p, len);
+                q += len;
+            }
+            *q++ = '/';
+            memcpy(q, args.argv[0], nameLen + 1);
+
+            execve(args.pathBuf, args.argv, args.envp);
+            if(errno == ENOEXEC)
+            {
+                args.shArgv[1] = args.pathBuf;
+                execve(args.shArgv[0], args.shArgv, args.envp);
+                return;
+            }
+            else if(errno == EACCES)
+            {
+                accessDenied = true;
+            }
+            else if(errno != ENOENT && errno != ENOTDIR)
+            {
+                return;
+            }
+        }
+        if(!end)
+        {
+            break;
+        }
+        p = end + 1;
+    }
+    if(accessDenied)
+    {
+        errno = EACCES;
+    }
+}
+
+void
+runChild(const ChildArgs& args)
+{
+    //
+    // Until exec, we can only use async-signal safe functions
+    //
+
+    //
+    // The signals are blocked by the parent around vfork. Reset the
+    // handlers installed by the node to the default disposition before
+    // restoring the signal mask, they must not run in the child.
+    //
+    struct sigaction dfl;
+    dfl.sa_handler = SIG_DFL;
+    dfl.sa_flags = 0;
+    sigemptyset(&dfl.sa_mask);
+    for(int sig = 1; sig < NSIG; ++sig)
+    {
+        struct sigaction current;
+        if(sigaction(sig, 0, &current) == 0 && current.sa_handler != SIG_DFL && current.sa_handler != SIG_IGN)
+        {
+            sigaction(sig, &dfl, 0);
+        }
+    }
+    sigprocmask(SIG_SETMASK, args.sigmask, 0);
+
+    //
+    // Unblock signals blocked by IceUtil::CtrlCHandler.
+    //
+    sigset_t sigs;
+    sigemptyset(&sigs);
+    sigaddset(&sigs, SIGHUP);
+    sigaddset(&sigs, SIGINT);
+    sigaddset(&sigs, SIGTERM);
+    sigprocmask(SIG_UNBLOCK, &sigs, 0);
+
+    //
+    // Change the uid/gid under which the process will run.
+    //
+    if(setGroupId(args.gid) == -1)
+    {
+        reportChildError(args.errorFd, SetGroupIdStep, errno);
+    }
+
+    if(args.setGroups && setGroups(args.ngroups, args.groups) == -1)
+    {
+        reportChildError(args.errorFd, SetGroupsStep, errno);
+    }
+
+    if(setUserId(args.uid) == -1)
+    {
+        reportChildError(args.errorFd, SetUserIdStep, errno);
+    }
+
+    //
+    // Assign a new process group for this process.
+    //
+    setpgid(0, 0);
+
+    //
+    // Close all file descriptors, except for standard input,
+    // standard output, standard error, and the write side
+    // of the pipes.
+    //
+    int lowFd = min(args.pipeFd, args.errorFd);
+    int highFd = max(args.pipeFd, args.errorFd);
+    closeFileDescriptors(3, lowFd - 1, args.maxFd);
+    closeFileDescriptors(lowFd + 1, highFd - 1, args.maxFd);
+    closeFileDescriptors(highFd + 1, INT_MAX, args.maxFd);
+
+    //
+    // Change working directory.
+    //
+    if(args.pwd[0] != '\0' && chdir(args.pwd) == -1)
+    {
+        reportChildError(args.errorFd, ChangeDirectoryStep, errno);
+    }
+
+    execute(args);
+    reportChildError(args.errorFd, ExecuteStep, errno);
+}
+
+//
+// Returns the environment of the node with the server environment
+// variables added, like putenv() would do in the server process.
+//
+StringSeq
+mergeEnvironment(const StringSeq& envs)
+{
+    StringSeq environment;
+    for(char** p = environ; *p != 0; ++p)
+    {
+        environment.push_back(*p);
+    }
+
+    for(StringSeq::const_iterator p = envs.begin(); p != envs.end(); ++p)
+    {
+        string::size_type pos = p->find('=');
+        string prefix = pos == string::npos ? *p + "=" : p->substr(0, pos + 1);
+        StringSeq::iterator q = environment.begin();
+        while(q != environment.end())
+        {
+            if(q->compare(0, prefix.size(), prefix) == 0)
+            {
+                q = environment.erase(q);
+            }
+            else
+            {
+                ++q;
+            }
+        }
+        if(pos != string::npos)
+        {
+            environment.push_back(*p);
+        }
+    }
+    return environment;
+}
+
 }
 
 #endif
@@ -324,6 +611,30 @@ Activator::Activator(const TraceLevelsPtr& traceLevels) :
     int flags = fcntl(_fdIntrRead, F_GETFL);
     flags |= O_NONBLOCK;
     fcntl(_fdIntrRead, F_SETFL, flags);
+
+#   if defined(__linux)
+    _epollFd = epoll_create(1);
+    if(_epollFd < 0)
+    {
+        int error = getSystemErrno();
+        close(_fdIntrRead);
+        close(_fdIntrWrite);
+        throw SyscallException(__FILE__, __LINE__, error);
+    }
+
+    epoll_event event;
+    memset(&event, 0, sizeof(epoll_event));
+    event.events = EPOLLIN;
+    event.data.fd = _fdIntrRead;
+    if(epoll_ctl(_epollFd, EPOLL_CTL_ADD, _fdIntrRead, &event) != 0)
+    {
+        int error = getSystemErrno();
+        close(_epollFd);
+        close(_fdIntrRead);
+        close(_fdIntrWrite);
+        throw SyscallException(__FILE__, __LINE__, error);
+    }
+#   endif
 #endif
 
 }
@@ -340,6 +651,9 @@ Activator::~Activator()
 #else
     close(_fdIntrRead);
     close(_fdIntrWrite);
+#   if defined(__linux)
+    close(_epollFd);
+#   endif
 #endif
 }
 
@@ -672,193 +986,201 @@ Activator::activate(const string& name,
     int errorFds[2];
     if(pipe(errorFds) != 0)
     {
-        throw SyscallException(__FILE__, __LINE__, getSystemErrno());
+        int error = getSystemErrno();
+        close(fds[0]);
+        close(fds[1]);
+        throw SyscallException(__FILE__, __LINE__, error);
     }
 
     //
-    // Convert to standard argc/argv.
+    // Close on exec the error message file descriptor.
     //
-    IceInternal::ArgVector av(args);
-    IceInternal::ArgVector env(envs);
+    fcntl(errorFds[1], F_SETFD, FD_CLOEXEC);
 
     //
-    // Current directory
+    // Prepare everything the child process needs. Until exec, the child
+    // process can only use async-signal safe functions and it can't
+    // allocate memory since it shares the address space of the node
+    // when it's created with vfork.
     //
-    const char* pwdCStr = pwd.c_str();
+    IceInternal::ArgVector av(args);
+    IceInternal::ArgVector env(mergeEnvironment(envs));
 
-    pid_t pid = fork();
-    if(pid == -1)
-    {
-        throw SyscallException(__FILE__, __LINE__, getSystemErrno());
-    }
+    StringSeq shArgs;
+    shArgs.push_back("/bin/sh");
+    shArgs.insert(shArgs.end(), args.begin(), args.end());
+    IceInternal::ArgVector shAv(shArgs);
 
-    if(pid == 0) // Child process.
+    string searchPath;
+    if(path.find('/') == string::npos)
     {
-        //
-        // Until exec, we can only use async-signal safe functions
-        //
-
-        //
-        // Unblock signals blocked by IceUtil::CtrlCHandler.
-        //
-        sigset_t sigs;
-        sigemptyset(&sigs);
-        sigaddset(&sigs, SIGHUP);
-        sigaddset(&sigs, SIGINT);
-        sigaddset(&sigs, SIGTERM);
-        sigprocmask(SIG_UNBLOCK, &sigs, 0);
-
-        //
-        // Change the uid/gid under which the process will run.
-        //
-        if(setgid(gid) == -1)
+        searchPath = "/bin:/usr/bin";
+        for(int i = 0; i < env.argc; ++i)
         {
-            ostringstream os;
-            os << gid;
-            reportChildError(getSystemErrno(), errorFds[1], "cannot set process group id", os.str().c_str(),
-                             _traceLevels);
-        }
-
-        //
-        // Don't initialize supplementary groups if we are not running as root.
-        //
-        if(getuid() == 0 && setgroups(groups.size(), &groups[0]) == -1)
-        {
-            ostringstream os;
-            os << pw->pw_name;
-            reportChildError(getSystemErrno(), errorFds[1], "cannot set process supplementary groups", os.str().c_str(),
-                                                             _traceLevels);
+            if(strncmp(env.argv[i], "PATH=", 5) == 0)
+            {
+                searchPath = env.argv[i] + 5;
+            }
         }
+    }
+    vector<char> pathBuf(searchPath.size() + path.size() + 2);
+
+    ChildArgs childArgs;
+    childArgs.uid = uid;
+    childArgs.gid = gid;
+    childArgs.setGroups = getuid() == 0; // Don't initialize supplementary groups if we are not running as root.
+    childArgs.groups = groups.empty() ? 0 : &groups[0];
+    childArgs.ngroups = groups.size();
+    childArgs.pwd = pwd.c_str();
+    childArgs.argv = av.argv;
+    childArgs.envp = env.argv;
+    childArgs.shArgv = shAv.argv;
+    childArgs.searchPath = searchPath.empty() ? 0 : searchPath.c_str();
+    childArgs.pathBuf = &pathBuf[0];
+    childArgs.pathBufSize = pathBuf.size();
+    childArgs.pipeFd = fds[1];
+    childArgs.errorFd = errorFds[1];
+    childArgs.maxFd = static_cast<int>(sysconf(_SC_OPEN_MAX));
 
-        if(setuid(uid) == -1)
-        {
-            ostringstream os;
-            os << uid;
-            reportChildError(getSystemErrno(), errorFds[1], "cannot set process user id", os.str().c_str(),
-                             _traceLevels);
-        }
+    //
+    // Block all the signals until the child has reset the signal
+    // handlers, a handler running in the child would otherwise run on
+    // the memory of the node.
+    //
+    sigset_t allSigs;
+    sigset_t oldSigs;
+    sigfillset(&allSigs);
+    pthread_sigmask(SIG_SETMASK, &allSigs, &oldSigs);
+    childArgs.sigmask = &oldSigs;
 
-        //
-        // Assign a new process group for this process.
-        //
-        setpgid(0, 0);
+    //
+    // On Linux, use vfork to not copy the page tables of the node: the
+    // activation time doesn't depend on the node memory footprint.
+    //
+#if defined(__linux)
+    pid_t pid = vfork();
+#else
+    pid_t pid = fork();
+#endif
+    if(pid != 0)
+    {
+        pthread_sigmask(SIG_SETMASK, &oldSigs, 0);
+    }
 
-        //
-        // Close all file descriptors, except for standard input,
-        // standard output, standard error, and the write side
-        // of the newly created pipe.
-        //
-        int maxFd = static_cast<int>(sysconf(_SC_OPEN_MAX));
-        for(int fd = 3; fd < maxFd; ++fd)
-        {
-            if(fd != fds[1] && fd != errorFds[1])
-            {
-                close(fd);
-            }
-        }
+    if(pid == -1)
+    {
+        int error = getSystemErrno();
+        close(fds[0]);
+        close(fds[1]);
+        close(errorFds[0]);
+        close(errorFds[1]);
+        throw SyscallException(__FILE__, __LINE__, error);
+    }
 
-        for(int i = 0; i < env.argc; i++)
-        {
-            //
-            // Each env is leaked on purpose ... see man putenv().
-            //
-            if(putenv(strdup(env.argv[i])) != 0)
-            {
-                reportChildError(errno, errorFds[1], "cannot set environment variable",  env.argv[i],
-                                 _traceLevels);
-            }
-        }
+    if(pid == 0) // Child process.
+    {
+        runChild(childArgs); // Doesn't return.
+    }
 
-        //
-        // Change working directory.
-        //
-        if(strlen(pwdCStr) != 0)
-        {
-            if(chdir(pwdCStr) == -1)
-            {
-                reportChildError(errno, errorFds[1], "cannot change working directory to",  pwdCStr,
-                                 _traceLevels);
-            }
-        }
+    close(fds[1]);
+    close(errorFds[1]);
 
-        //
-        // Close on exec the error message file descriptor.
-        //
-        int flags = fcntl(errorFds[1], F_GETFD);
-        flags |= 1; // FD_CLOEXEC
-        if(fcntl(errorFds[1], F_SETFD, flags) == -1)
+    //
+    // Read a potential error reported over the error message pipe.
+    //
+    int error[2];
+    size_t sz = 0;
+    while(sz < sizeof(error))
+    {
+        ssize_t rs = read(errorFds[0], reinterpret_cast<char*>(error) + sz, sizeof(error) - sz);
+        if(rs > 0)
         {
-            close(errorFds[1]);
-            errorFds[1] = -1;
+            sz += static_cast<size_t>(rs);
         }
-
-        if(execvp(av.argv[0], av.argv) == -1)
+        else if(rs == 0 || errno != EINTR)
         {
-            if(errorFds[1] != -1)
-            {
-                reportChildError(errno, errorFds[1], "cannot execute",  av.argv[0], _traceLevels);
-            }
-            else
-            {
-                reportChildError(errno, fds[1], "cannot execute",  av.argv[0], _traceLevels);
-            }
+            break;
         }
     }
-    else // Parent process.
+    close(errorFds[0]);
+
+    //
+    // If an error occured before the exec() we do some cleanup and throw.
+    //
+    if(sz == sizeof(error))
     {
-        close(fds[1]);
-        close(errorFds[1]);
+        close(fds[0]);
+        waitPid(pid);
 
-        //
-        // Read a potential error message over the error message pipe.
-        //
-        char s[16];
-        ssize_t rs;
-        string message;
-        while((rs = read(errorFds[0], &s, 16)) > 0)
+        ostringstream os;
+        switch(error[0])
         {
-            message.append(s, rs);
+        case SetGroupIdStep:
+            os << "cannot set process group id `" << gid << "'";
+            break;
+        case SetGroupsStep:
+            os << "cannot set process supplementary groups `" << pw->pw_name << "'";
+            break;
+        case SetUserIdStep:
+            os << "cannot set process user id `" << uid << "'";
+            break;
+        case ChangeDirectoryStep:
+            os << "cannot change working directory to `" << pwd << "'";
+            break;
+        default:
+            os << "cannot execute `" << path << "'";
+            break;
         }
-
-        //
-        // If an error occured before the exec() we do some cleanup and throw.
-        //
-        if(!message.empty())
+        if(error[1])
         {
-            close(fds[0]);
-            close(errorFds[0]);
-            waitPid(pid);
-            throw runtime_error(message);
+            os << ": " << IceUtilInternal::errorToString(error[1]);
         }
+        throw runtime_error(os.str());
+    }
 
-        //
-        // Otherwise, the exec() was successfull and we don't need the error message
-        // pipe anymore.
-        //
-        close(errorFds[0]);
+    int flags = fcntl(fds[0], F_GETFL);
+    flags |= O_NONBLOCK;
+    fcntl(fds[0], F_SETFL, flags);
 
-        Process process;
-        process.pid = pid;
-        process.pipeFd = fds[0];
-        process.server = server;
-        _processes.insert(make_pair(name, process));
+#if defined(__linux)
+    //
+    // Register the pipe before recording the process. If this fails, the
+    // server is killed, it couldn't be monitored.
+    //
+    epoll_event event;
+    memset(&event, 0, sizeof(epoll_event));
+    event.events = EPOLLIN;
+    event.data.fd = fds[0];
+    if(epoll_ctl(_epollFd, EPOLL_CTL_ADD, fds[0], &event) != 0)
+    {
+        int err = getSystemErrno();
+        close(fds[0]);
+        ::kill(pid, SIGKILL);
+        waitPid(pid);
+        throw SyscallException(__FILE__, __LINE__, err);
+    }
+#endif
 
-        int flags = fcntl(process.pipeFd, F_GETFL);
-        flags |= O_NONBLOCK;
-        fcntl(process.pipeFd, F_SETFL, flags);
+    Process process;
+    process.pid = pid;
+    process.pipeFd = fds[0];
+    process.server = server;
+    _processes.insert(make_pair(name, process));
+    _pipeFds.insert(make_pair(process.pipeFd, name));
 
-        setInterrupt();
+#if !defined(__linux)
+    setInterrupt();
+#endif
 
     //
     // Don't print the following trace, this might interfere with the
     // output of the started process if it fails with an error message.
     //
-//      if(_traceLevels->activator > 0)
-//      {
-//          Ice::Trace out(_traceLevels->logger, _traceLevels->activatorCat);
-//          out << "activated server `" << name << "' (pid = " << pid << ")";
-//      }
-    }
+//  if(_traceLevels->activator > 0)
+//  {
+//      Ice::Trace out(_traceLevels->logger, _traceLevels->activatorCat);
+//      out << "activated server `" << name << "' (pid = " << pid << ")";
+//  }
 
     return pid;
 #endif
@@ -1235,70 +1557,97 @@ Activator::terminationListener()
 #else
     while(true)
     {
-        fd_set fdSet;
-        int maxFd = _fdIntrRead;
-        FD_ZERO(&fdSet);
-        FD_SET(_fdIntrRead, &fdSet);
+        //
+        // Wait for the interrupt pipe or the termination pipes of the
+        // processes to be readable. On Linux, the pipes are registered
+        // with epoll when the processes are activated.
+        //
+        vector<int> readyFds;
+#   if defined(__linux)
+        epoll_event events[64];
+        int ret = epoll_wait(_epollFd, events, 64, -1);
+        if(ret == -1)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            throw SyscallException(__FILE__, __LINE__, getSystemErrno());
+        }
 
+        for(int i = 0; i < ret; ++i)
+        {
+            readyFds.push_back(events[i].data.fd);
+        }
+#   else
+        vector<struct pollfd> pollFds;
         {
             IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
 
-            for(map<string, Process>::iterator p = _processes.begin(); p != _processes.end(); ++p)
+            struct pollfd pollFd;
+            pollFd.fd = _fdIntrRead;
+            pollFd.events = POLLIN;
+            pollFd.revents = 0;
+            pollFds.push_back(pollFd);
+            for(map<int, string>::const_iterator p = _pipeFds.begin(); p != _pipeFds.end(); ++p)
             {
-                int fd = p->second.pipeFd;
-                FD_SET(fd, &fdSet);
-                if(maxFd < fd)
-                {
-                    maxFd = fd;
-                }
+                pollFd.fd = p->first;
+                pollFds.push_back(pollFd);
             }
         }
 
-    repeatSelect:
-        int ret = ::select(maxFd + 1, &fdSet, 0, 0, 0);
-        assert(ret != 0);
-
+        int ret = ::poll(&pollFds[0], static_cast<nfds_t>(pollFds.size()), -1);
         if(ret == -1)
         {
 #ifdef EPROTO
             if(errno == EINTR || errno == EPROTO)
             {
-                goto repeatSelect;
+                continue;
             }
 #else
             if(errno == EINTR)
             {
-                goto repeatSelect;
+                continue;
             }
 #endif
-
             throw SyscallException(__FILE__, __LINE__, getSystemErrno());
         }
 
+        for(vector<struct pollfd>::const_iterator p = pollFds.begin(); p != pollFds.end(); ++p)
+        {
+            if(p->revents != 0)
+            {
+                readyFds.push_back(p->fd);
+            }
+        }
+#   endif
+
         vector<Process> terminated;
         bool deactivated = false;
         {
             IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
 
-            if(FD_ISSET(_fdIntrRead, &fdSet))
+            for(vector<int>::const_iterator q = readyFds.begin(); q != readyFds.end(); ++q)
             {
-                clearInterrupt();
-
-                if(_deactivating && _processes.empty())
+                int fd = *q;
+                if(fd == _fdIntrRead)
                 {
-                    return;
+                    clearInterrupt();
+
+                    if(_deactivating && _processes.empty())
+                    {
+                        return;
+                    }
+                    continue;
                 }
-            }
 
-            map<string, Process>::iterator p = _processes.begin();
-            while(p != _processes.end())
-            {
-                int fd = p->second.pipeFd;
-                if(!FD_ISSET(fd, &fdSet))
+                map<int, string>::iterator r = _pipeFds.find(fd);
+                if(r == _pipeFds.end())
                 {
-                    ++p;
                     continue;
                 }
+                map<string, Process>::iterator p = _processes.find(r->second);
+                assert(p != _processes.end());
 
                 char s[16];
                 ssize_t rs;
@@ -1326,8 +1675,6 @@ Activator::terminationListener()
                     {
                         throw SyscallException(__FILE__, __LINE__, getSystemErrno());
                     }
-
-                    ++p;
                 }
                 else if(rs == 0)
                 {
@@ -1337,8 +1684,12 @@ Activator::terminationListener()
 
                     terminated.push_back(p->second);
 
-                    close(p->second.pipeFd);
-                    _processes.erase(p++);
+#   if defined(__linux)
+                    epoll_ctl(_epollFd, EPOLL_CTL_DEL, fd, 0);
+#   endif
+                    close(fd);
+                    _pipeFds.erase(r);
+                    _processes.erase(p);
                 }
             }
 
@@ -95,6 +95,10 @@ private:
 #else
     int _fdIntrRead;
     int _fdIntrWrite;
+#   if defined(__linux)
+    int _epollFd;
+#   endif
+    std::map<int, std::string> _pipeFds;
 #endif
 
     IceUtil::ThreadPtr _thread;
@@ -57,6 +57,33 @@ public:
     LoadSample _loadSample;
 };
 
+//
+// Power-of-two-choices: of two randomly picked replicas, prefer the
+// one whose server reported the lowest dispatch load. The load is
+// estimated as the time needed to process the in-progress dispatches
+// and a new one, (current + 1) * latency. If one of the two servers
+// didn't report its dispatch load, fall back to the load of the
+// nodes.
+//
+bool
+preferSecondReplica(const ServerAdapterEntryPtr& first, const ServerAdapterEntryPtr& second)
+{
+    ServerDispatchLoad load1;
+    ServerDispatchLoad load2;
+    if(!first->getDispatchLoad(load1) || !second->getDispatchLoad(load2))
+    {
+        return second->getLeastLoadedNodeLoad(LoadSample1) < first->getLeastLoadedNodeLoad(LoadSample1);
+    }
+    else if(load1.latency < 0.0f || load2.latency < 0.0f)
+    {
+        return load2.current < load1.current;
+    }
+    else
+    {
+        return (load2.current + 1) * load2.latency < (load1.current + 1) * load1.latency;
+    }
+}
+
 struct TransformToReplica : public unary_function<const pair<string, ServerAdapterEntryPtr>&, ServerAdapterEntryPtr>
 {
     ServerAdapterEntryPtr
@@ -409,6 +436,32 @@ ServerAdapterEntry::getLeastLoadedNodeLoad(LoadSample loadSample) const
     return 999.9f;
 }
 
+bool
+ServerAdapterEntry::getDispatchLoad(ServerDispatchLoad& load) const
+{
+    try
+    {
+        return _server->getDispatchLoad(load);
+    }
+    catch(const ServerNotExistException&)
+    {
+        // This might happen if the application is updated concurrently.
+    }
+    catch(const NodeNotExistException&)
+    {
+        // This might happen if the application is updated concurrently.
+    }
+    catch(const NodeUnreachableException&)
+    {
+    }
+    catch(const Ice::Exception& ex)
+    {
+        Ice::Error error(_cache.getTraceLevels()->logger);
+        error << "unexpected exception while getting server dispatch load:\n" << ex;
+    }
+    return false;
+}
+
 AdapterInfoSeq
 ServerAdapterEntry::getAdapterInfo() const
 {
@@ -585,10 +638,16 @@ ReplicaGroupEntry::update(const string& application, const LoadBalancingPolicyPt
     int nReplicas = 0;
     is >> nReplicas;
     _loadBalancingNReplicas = nReplicas < 0 ? 1 : nReplicas;
+    _dispatchLoad = false;
     AdaptiveLoadBalancingPolicyPtr alb = AdaptiveLoadBalancingPolicyPtr::dynamicCast(_loadBalancing);
     if(alb)
     {
-        if(alb->loadSample == "1")
+        if(alb->loadSample == "dispatch")
+        {
+            _loadSample = LoadSample1;
+            _dispatchLoad = true;
+        }
+        else if(alb->loadSample == "1")
         {
             _loadSample = LoadSample1;
         }
@@ -613,6 +672,7 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
 {
     vector<ServerAdapterEntryPtr> replicas;
     bool adaptive = false;
+    bool dispatchLoad = false;
     LoadSample loadSample = LoadSample1;
     {
         Lock sync(*this);
@@ -648,7 +708,8 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
             RandomNumberGenerator rng;
             random_shuffle(replicas.begin(), replicas.end(), rng);
             loadSample = _loadSample;
-            adaptive = true;
+            adaptive = !_dispatchLoad;
+            dispatchLoad = _dispatchLoad;
         }
         else if(OrderedLoadBalancingPolicyPtr::dynamicCast(_loadBalancing))
         {
@@ -682,6 +743,19 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
             replicas.clear();
             transform(rl.begin(), rl.end(), back_inserter(replicas), TransformToReplica());
         }
+        else if(dispatchLoad && replicas.size() > 1)
+        {
+            //
+            // The replicas are already shuffled, compare the first two
+            // instead of sorting all the replicas by load: this only
+            // requires two load lookups and it avoids sending all the
+            // clients to the same replica until its next load report.
+            //
+            if(preferSecondReplica(replicas[0], replicas[1]))
+            {
+                swap(replicas[0], replicas[1]);
+            }
+        }
 
         //
         // Retrieve the proxy of each adapter from the server. The adapter
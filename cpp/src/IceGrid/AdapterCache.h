@@ -86,6 +86,7 @@ public:
     virtual AdapterPrx getProxy(const std::string&, bool) const;
 
     void getLocatorAdapterInfo(LocatorAdapterInfoSeq&) const;
+    bool getDispatchLoad(ServerDispatchLoad&) const;
     const std::string& getReplicaGroupId() const { return _replicaGroupId; }
     int getPriority() const;
 
@@ -128,6 +129,7 @@ private:
     LoadBalancingPolicyPtr _loadBalancing;
     int _loadBalancingNReplicas;
     LoadSample _loadSample;
+    bool _dispatchLoad;
     std::string _filter;
     std::vector<ServerAdapterEntryPtr> _replicas;
     int _lastReplica;
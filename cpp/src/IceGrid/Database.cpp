@@ -30,11 +30,10 @@
 using namespace std;
 using namespace IceGrid;
 
-typedef IceDB::ReadWriteCursor<string, ApplicationInfo, IceDB::IceContext, Ice::OutputStream> ApplicationMapRWCursor;
 typedef IceDB::ReadOnlyCursor<string, AdapterInfo, IceDB::IceContext, Ice::OutputStream> AdapterMapROCursor;
 typedef IceDB::Cursor<string, string, IceDB::IceContext, Ice::OutputStream> AdaptersByGroupMapCursor;
-typedef IceDB::ReadOnlyCursor<string, Ice::Identity, IceDB::IceContext, Ice::OutputStream> ObjectsByTypeMapROCursor;
 typedef IceDB::ReadOnlyCursor<Ice::Identity, ObjectInfo, IceDB::IceContext, Ice::OutputStream> ObjectsMapROCursor;
+typedef IceDB::CursorIterator<Ice::Identity, ObjectInfo, IceDB::IceContext, Ice::OutputStream> ObjectsMapIterator;
 
 namespace
 {
@@ -56,16 +55,20 @@ struct ObjectLoadCI : binary_function<pair<Ice::ObjectPrx, float>&, pair<Ice::Ob
     }
 };
 
+//
+// The records are decoded in place, keys aren't decoded when only the
+// values are needed.
+//
 template<typename K, typename V, typename C, typename H> vector<V>
 toVector(const IceDB::ReadOnlyTxn& txn, const IceDB::Dbi<K, V, C, H>& m)
 {
     vector<V> v;
     IceDB::ReadOnlyCursor<K, V, C, H> cursor(m, txn);
-    K key;
-    V value;
-    while(cursor.get(key, value, MDB_NEXT))
+    const IceDB::CursorIterator<K, V, C, H> end;
+    for(IceDB::CursorIterator<K, V, C, H> p(cursor); p != end; ++p)
     {
-        v.push_back(value);
+        v.push_back(V());
+        p->second.read(v.back());
     }
     return v;
 }
@@ -75,12 +78,10 @@ toMap(const IceDB::Txn& txn, const IceDB::Dbi<K, V, C, H>& d)
 {
     std::map<K, V> m;
     IceDB::Cursor<K, V, C, H> cursor(d, txn);
-    K key;
-    V value;
-    while(cursor.get(key, value, MDB_NEXT))
+    const IceDB::CursorIterator<K, V, C, H> end;
+    for(IceDB::CursorIterator<K, V, C, H> p(cursor); p != end; ++p)
     {
-        typename std::map<K, V>::value_type v(key, value);
-        m.insert(v);
+        p->second.read(m.insert(m.end(), make_pair(p->first.value(), V()))->second);
     }
     cursor.close();
     return m;
@@ -165,31 +166,211 @@ findByReplicaGroupId(const IceDB::Txn& txn,
     return result;
 }
 
-vector<ObjectInfo>
-findByType(const IceDB::ReadOnlyTxn& txn,
-           const IdentityObjectInfoMap& objects,
-           const StringIdentityMap& objectsByType,
-           const string& type)
+}
+
+void
+AdapterInfoIndex::put(const AdapterInfo& info)
 {
-    vector<ObjectInfo> result;
-    ObjectsByTypeMapROCursor cursor(objectsByType, txn);
-    Ice::Identity id;
-    if(cursor.find(type, id))
+    Lock sync(*this);
+    map<string, AdapterInfo>::iterator p = _adapters.find(info.id);
+    if(p != _adapters.end())
     {
-        ObjectInfo info;
-        objects.get(txn, id, info);
-        result.push_back(info);
+        if(p->second.replicaGroupId != info.replicaGroupId)
+        {
+            map<string, set<string> >::iterator q = _adaptersByGroupId.find(p->second.replicaGroupId);
+            assert(q != _adaptersByGroupId.end());
+            q->second.erase(info.id);
+            if(q->second.empty())
+            {
+                _adaptersByGroupId.erase(q);
+            }
+        }
+        p->second = info;
+    }
+    else
+    {
+        _adapters.insert(make_pair(info.id, info));
+    }
+    _adaptersByGroupId[info.replicaGroupId].insert(info.id);
+}
+
+void
+AdapterInfoIndex::remove(const string& id)
+{
+    Lock sync(*this);
+    map<string, AdapterInfo>::iterator p = _adapters.find(id);
+    if(p == _adapters.end())
+    {
+        return;
+    }
+
+    map<string, set<string> >::iterator q = _adaptersByGroupId.find(p->second.replicaGroupId);
+    assert(q != _adaptersByGroupId.end());
+    q->second.erase(id);
+    if(q->second.empty())
+    {
+        _adaptersByGroupId.erase(q);
+    }
+    _adapters.erase(p);
+}
 
-        string t;
-        while(cursor.get(t, id, MDB_NEXT) && t == type)
+void
+AdapterInfoIndex::reset(const AdapterInfoSeq& infos)
+{
+    map<string, AdapterInfo> adapters;
+    map<string, set<string> > adaptersByGroupId;
+    for(AdapterInfoSeq::const_iterator p = infos.begin(); p != infos.end(); ++p)
+    {
+        adapters[p->id] = *p;
+        adaptersByGroupId[p->replicaGroupId].insert(p->id);
+    }
+
+    Lock sync(*this);
+    _adapters.swap(adapters);
+    _adaptersByGroupId.swap(adaptersByGroupId);
+}
+
+bool
+AdapterInfoIndex::get(const string& id, AdapterInfo& info) const
+{
+    Lock sync(*this);
+    map<string, AdapterInfo>::const_iterator p = _adapters.find(id);
+    if(p == _adapters.end())
+    {
+        return false;
+    }
+    info = p->second;
+    return true;
+}
+
+AdapterInfoSeq
+AdapterInfoIndex::getByReplicaGroupId(const string& replicaGroupId) const
+{
+    Lock sync(*this);
+    AdapterInfoSeq infos;
+    map<string, set<string> >::const_iterator p = _adaptersByGroupId.find(replicaGroupId);
+    if(p != _adaptersByGroupId.end())
+    {
+        infos.reserve(p->second.size());
+        for(set<string>::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
         {
-            objects.get(txn, id, info);
-            result.push_back(info);
+            map<string, AdapterInfo>::const_iterator r = _adapters.find(*q);
+            assert(r != _adapters.end());
+            infos.push_back(r->second);
         }
     }
-    return result;
+    return infos;
+}
+
+void
+ObjectInfoIndex::put(const ObjectInfo& info)
+{
+    const Ice::Identity id = info.proxy->ice_getIdentity();
+
+    Lock sync(*this);
+    map<Ice::Identity, ObjectInfo>::iterator p = _objects.find(id);
+    if(p != _objects.end())
+    {
+        if(p->second.type != info.type)
+        {
+            map<string, set<Ice::Identity> >::iterator q = _objectsByType.find(p->second.type);
+            assert(q != _objectsByType.end());
+            q->second.erase(id);
+            if(q->second.empty())
+            {
+                _objectsByType.erase(q);
+            }
+        }
+        p->second = info;
+    }
+    else
+    {
+        _objects.insert(make_pair(id, info));
+    }
+    _objectsByType[info.type].insert(id);
+}
+
+void
+ObjectInfoIndex::remove(const Ice::Identity& id)
+{
+    Lock sync(*this);
+    map<Ice::Identity, ObjectInfo>::iterator p = _objects.find(id);
+    if(p == _objects.end())
+    {
+        return;
+    }
+
+    map<string, set<Ice::Identity> >::iterator q = _objectsByType.find(p->second.type);
+    assert(q != _objectsByType.end());
+    q->second.erase(id);
+    if(q->second.empty())
+    {
+        _objectsByType.erase(q);
+    }
+    _objects.erase(p);
+}
+
+void
+ObjectInfoIndex::reset(const ObjectInfoSeq& infos)
+{
+    map<Ice::Identity, ObjectInfo> objects;
+    map<string, set<Ice::Identity> > objectsByType;
+    for(ObjectInfoSeq::const_iterator p = infos.begin(); p != infos.end(); ++p)
+    {
+        const Ice::Identity id = p->proxy->ice_getIdentity();
+        objects[id] = *p;
+        objectsByType[p->type].insert(id);
+    }
+
+    Lock sync(*this);
+    _objects.swap(objects);
+    _objectsByType.swap(objectsByType);
+}
+
+bool
+ObjectInfoIndex::get(const Ice::Identity& id, ObjectInfo& info) const
+{
+    Lock sync(*this);
+    map<Ice::Identity, ObjectInfo>::const_iterator p = _objects.find(id);
+    if(p == _objects.end())
+    {
+        return false;
+    }
+    info = p->second;
+    return true;
+}
+
+ObjectInfoSeq
+ObjectInfoIndex::getByType(const string& type) const
+{
+    Lock sync(*this);
+    ObjectInfoSeq infos;
+    map<string, set<Ice::Identity> >::const_iterator p = _objectsByType.find(type);
+    if(p != _objectsByType.end())
+    {
+        infos.reserve(p->second.size());
+        for(set<Ice::Identity>::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+        {
+            map<Ice::Identity, ObjectInfo>::const_iterator r = _objects.find(*q);
+            assert(r != _objects.end());
+            infos.push_back(r->second);
+        }
+    }
+    return infos;
+}
+
+DatabaseGroupCommit::DatabaseGroupCommit(const IceDB::Env& env, IceUtil::Monitor<IceUtil::Mutex>& database,
+                                         const IceUtil::Time& maxLatency) :
+    IceDB::GroupCommit(env, maxLatency),
+    _database(database)
+{
 }
 
+void
+DatabaseGroupCommit::commit(const vector<IceDB::GroupWrite*>& writes, int& error)
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_database);
+    IceDB::GroupCommit::commit(writes, error);
 }
 
 Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
@@ -214,6 +395,8 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
     _dbLock(_communicator->getProperties()->getProperty("IceGrid.Registry.LMDB.Path") + "/icedb.lock"),
     _env(_communicator->getProperties()->getProperty("IceGrid.Registry.LMDB.Path"), 8,
          IceDB::getMapSize(_communicator->getProperties()->getPropertyAsInt("IceGrid.Registry.LMDB.MapSize"))),
+    _groupCommit(_env, *this, IceUtil::Time::milliSeconds(
+                     _communicator->getProperties()->getPropertyAsInt("IceGrid.Registry.LMDB.GroupCommitMaxLatency"))),
     _pluginFacade(RegistryPluginFacadeIPtr::dynamicCast(getRegistryPluginFacade())),
     _lock(0)
 {
@@ -239,19 +422,21 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
 
     ServerEntrySeq entries;
 
-    string k;
-    ApplicationInfo v;
-    ApplicationMapRWCursor cursor(_applications, txn);
-    while(cursor.get(k, v, MDB_NEXT))
+    //
+    // The applications are decoded once, to load them and to initialize
+    // the application observer topic.
+    //
+    map<string, ApplicationInfo> applications = toMap(txn, _applications);
+    for(map<string, ApplicationInfo>::const_iterator p = applications.begin(); p != applications.end(); ++p)
     {
         try
         {
-            load(ApplicationHelper(_communicator, v.descriptor), entries, v.uuid, v.revision);
+            load(ApplicationHelper(_communicator, p->second.descriptor), entries, p->second.uuid, p->second.revision);
         }
         catch(const DeploymentException& ex)
         {
             Ice::Error err(_traceLevels->logger);
-            err << "invalid application `" << k << "':\n" << ex.reason;
+            err << "invalid application `" << p->first << "':\n" << ex.reason;
         }
     }
 
@@ -282,15 +467,30 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
         _serials.put(txn, objectsDbName, 1);
     }
 
+    map<string, AdapterInfo> adapters = toMap(txn, _adapters);
+    map<Ice::Identity, ObjectInfo> objects = toMap(txn, _objects);
+    map<Ice::Identity, ObjectInfo> internalObjects = toMap(txn, _internalObjects);
+
     _applicationObserverTopic =
-        new ApplicationObserverTopic(_topicManager, toMap(txn, _applications), getSerial(txn, applicationsDbName));
-    _adapterObserverTopic =
-        new AdapterObserverTopic(_topicManager, toMap(txn, _adapters), getSerial(txn, adaptersDbName));
-    _objectObserverTopic =
-        new ObjectObserverTopic(_topicManager, toMap(txn, _objects), getSerial(txn, objectsDbName));
+        new ApplicationObserverTopic(_topicManager, applications, getSerial(txn, applicationsDbName));
+    _adapterObserverTopic = new AdapterObserverTopic(_topicManager, adapters, getSerial(txn, adaptersDbName));
+    _objectObserverTopic = new ObjectObserverTopic(_topicManager, objects, getSerial(txn, objectsDbName));
 
     txn.commit();
 
+    for(map<string, AdapterInfo>::const_iterator p = adapters.begin(); p != adapters.end(); ++p)
+    {
+        _adapterIndex.put(p->second);
+    }
+    for(map<Ice::Identity, ObjectInfo>::const_iterator p = objects.begin(); p != objects.end(); ++p)
+    {
+        _objectIndex.put(p->second);
+    }
+    for(map<Ice::Identity, ObjectInfo>::const_iterator p = internalObjects.begin(); p != internalObjects.end(); ++p)
+    {
+        _internalObjectIndex.put(p->second);
+    }
+
     _registryObserverTopic->registryUp(info);
 
     _pluginFacade->setDatabase(this);
@@ -471,6 +671,7 @@ Database::syncAdapters(const AdapterInfoSeq& adapters, Ice::Long dbSerial)
             dbSerial = updateSerial(txn, adaptersDbName, dbSerial);
 
             txn.commit();
+            _adapterIndex.reset(adapters);
         }
         catch(const IceDB::KeyTooLongException&)
         {
@@ -513,6 +714,7 @@ Database::syncObjects(const ObjectInfoSeq& objects, Ice::Long dbSerial)
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
             txn.commit();
+            _objectIndex.reset(objects);
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -993,108 +1195,195 @@ Database::getAllocatableObject(const Ice::Identity& id) const
     return _allocatableObjectCache.get(id);
 }
 
-void
-Database::setAdapterDirectProxy(const string& adapterId, const string& replicaGroupId, const Ice::ObjectPrx& proxy,
-                                Ice::Long dbSerial)
+//
+// The registration of an adapter direct proxy, adapters of a node are
+// registered concurrently when the node starts so the registrations are
+// committed with the database group commit.
+//
+class Database::AdapterDirectProxyWrite : public IceDB::GroupWrite
 {
-    assert(dbSerial != 0 || _master);
+public:
 
-    int serial = 0; // Initialize to prevent warning.
+    AdapterDirectProxyWrite(Database& database, const string& adapterId, const string& replicaGroupId,
+                            const Ice::ObjectPrx& proxy, Ice::Long dbSerial) :
+        _database(database),
+        _dbSerial(dbSerial),
+        _updated(false),
+        _executed(false),
+        _serial(0)
     {
-        Lock sync(*this);
-        if(_adapterCache.has(adapterId))
+        _info.id = adapterId;
+        _info.proxy = proxy;
+        _info.replicaGroupId = replicaGroupId;
+    }
+
+    virtual bool
+    execute(const IceDB::ReadWriteTxn& txn)
+    {
+        //
+        // Called with the database locked.
+        //
+        if(_database._adapterCache.has(_info.id))
         {
-            throw AdapterExistsException(adapterId);
+            _exception.reset(AdapterExistsException(_info.id).ice_clone());
+            return false;
         }
 
-        AdapterInfo info;
-        info.id = adapterId;
-        info.proxy = proxy;
-        info.replicaGroupId = replicaGroupId;
-
-        bool updated = false;
         try
         {
-            IceDB::ReadWriteTxn txn(_env);
-
             AdapterInfo oldInfo;
-            bool found = _adapters.get(txn, adapterId, oldInfo);
-            if(proxy)
+            bool found = _database._adapters.get(txn, _info.id, oldInfo);
+            if(_info.proxy)
             {
-                updated = found;
+                _updated = found;
 
-                if(replicaGroupId != oldInfo.replicaGroupId)
+                if(_info.replicaGroupId != oldInfo.replicaGroupId)
                 {
-                    _adaptersByGroupId.del(txn, oldInfo.replicaGroupId, adapterId);
+                    _database._adaptersByGroupId.del(txn, oldInfo.replicaGroupId, _info.id);
                 }
-                addAdapter(txn, info);
+                _database.addAdapter(txn, _info);
             }
             else
             {
                 if(!found)
                 {
-                    return;
+                    return false;
                 }
-                deleteAdapter(txn, oldInfo);
+                _database.deleteAdapter(txn, oldInfo);
             }
-            dbSerial = updateSerial(txn, adaptersDbName, dbSerial);
-
-            txn.commit();
+            _dbSerial = _database.updateSerial(txn, adaptersDbName, _dbSerial);
         }
-        catch(const IceDB::KeyTooLongException&)
+        catch(const IceDB::KeyTooLongException& ex)
         {
-            throw;
+            _exception.reset(ex.ice_clone());
+            return false;
         }
         catch(const IceDB::LMDBException& ex)
         {
-            logError(_communicator, ex);
-            throw;
+            logError(_database._communicator, ex);
+            _exception.reset(ex.ice_clone());
+            return false;
         }
+        _executed = true;
+        return true;
+    }
 
-        if(_traceLevels->adapter > 0)
+    virtual void
+    completed(bool committed)
+    {
+        //
+        // Called with the database locked.
+        //
+        if(!committed || !_executed)
         {
-            Ice::Trace out(_traceLevels->logger, _traceLevels->adapterCat);
-            out << (proxy ? (updated ? "updated" : "added") : "removed") << " adapter `" << adapterId << "'";
-            if(!replicaGroupId.empty())
+            return;
+        }
+
+        if(_info.proxy)
+        {
+            _database._adapterIndex.put(_info);
+        }
+        else
+        {
+            _database._adapterIndex.remove(_info.id);
+        }
+
+        if(_database._traceLevels->adapter > 0)
+        {
+            Ice::Trace out(_database._traceLevels->logger, _database._traceLevels->adapterCat);
+            out << (_info.proxy ? (_updated ? "updated" : "added") : "removed") << " adapter `" << _info.id << "'";
+            if(!_info.replicaGroupId.empty())
             {
-                out << " with replica group `" << replicaGroupId << "'";
+                out << " with replica group `" << _info.replicaGroupId << "'";
             }
-            out << " (serial = `" << dbSerial << "')";
+            out << " (serial = `" << _dbSerial << "')";
         }
 
-        if(proxy)
+        if(_info.proxy)
         {
-            if(updated)
+            if(_updated)
             {
-                serial = _adapterObserverTopic->adapterUpdated(dbSerial, info);
+                _serial = _database._adapterObserverTopic->adapterUpdated(_dbSerial, _info);
             }
             else
             {
-                serial = _adapterObserverTopic->adapterAdded(dbSerial, info);
+                _serial = _database._adapterObserverTopic->adapterAdded(_dbSerial, _info);
             }
         }
         else
         {
-            serial = _adapterObserverTopic->adapterRemoved(dbSerial, adapterId);
+            _serial = _database._adapterObserverTopic->adapterRemoved(_dbSerial, _info.id);
         }
     }
-    _adapterObserverTopic->waitForSyncedSubscribers(serial);
+
+    void
+    throwException() const
+    {
+        if(_exception.get())
+        {
+            _exception->ice_throw();
+        }
+    }
+
+    bool
+    executed() const
+    {
+        return _executed;
+    }
+
+    int
+    serial() const
+    {
+        return _serial;
+    }
+
+private:
+
+    Database& _database;
+    AdapterInfo _info;
+    Ice::Long _dbSerial;
+    bool _updated;
+    bool _executed;
+    int _serial;
+    IceInternal::UniquePtr<IceUtil::Exception> _exception;
+};
+
+void
+Database::setAdapterDirectProxy(const string& adapterId, const string& replicaGroupId, const Ice::ObjectPrx& proxy,
+                                Ice::Long dbSerial)
+{
+    assert(dbSerial != 0 || _master);
+
+    AdapterDirectProxyWrite write(*this, adapterId, replicaGroupId, proxy, dbSerial);
+    try
+    {
+        _groupCommit.write(write);
+    }
+    catch(const IceDB::LMDBException& ex)
+    {
+        logError(_communicator, ex);
+        throw;
+    }
+    write.throwException();
+
+    if(write.executed())
+    {
+        _adapterObserverTopic->waitForSyncedSubscribers(write.serial());
+    }
 }
 
 Ice::ObjectPrx
 Database::getAdapterDirectProxy(const string& id, const Ice::EncodingVersion& encoding, const Ice::ConnectionPtr& con,
                                 const Ice::Context& ctx)
 {
-    IceDB::ReadOnlyTxn txn(_env);
-
     AdapterInfo info;
-    if(_adapters.get(txn, id, info))
+    if(_adapterIndex.get(id, info))
     {
         return info.proxy;
     }
 
     Ice::EndpointSeq endpoints;
-    vector<AdapterInfo> infos = findByReplicaGroupId(txn, _adapters, _adaptersByGroupId, id);
+    vector<AdapterInfo> infos = _adapterIndex.getByReplicaGroupId(id);
     if(infos.empty())
     {
         throw AdapterNotExistException(id);
@@ -1160,6 +1449,18 @@ Database::removeAdapter(const string& adapterId)
             dbSerial = updateSerial(txn, adaptersDbName);
 
             txn.commit();
+
+            if(infos.empty())
+            {
+                _adapterIndex.remove(adapterId);
+            }
+            else
+            {
+                for(AdapterInfoSeq::const_iterator p = infos.begin(); p != infos.end(); ++p)
+                {
+                    _adapterIndex.put(*p);
+                }
+            }
         }
         catch(const IceDB::KeyTooLongException&)
         {
@@ -1279,11 +1580,9 @@ Database::getAdapterInfo(const string& id)
     // Otherwise, we check the adapter endpoint table -- if there's an
     // entry the adapter is managed by the registry itself.
     //
-    IceDB::ReadOnlyTxn txn(_env);
-
     AdapterInfo info;
     AdapterInfoSeq infos;
-    if(_adapters.get(txn, id, info))
+    if(_adapterIndex.get(id, info))
     {
         infos.push_back(info);
     }
@@ -1293,7 +1592,7 @@ Database::getAdapterInfo(const string& id)
         // If it's not a regular object adapter, perhaps it's a replica
         // group...
         //
-        infos = findByReplicaGroupId(txn, _adapters, _adaptersByGroupId, id);
+        infos = _adapterIndex.getByReplicaGroupId(id);
         if(infos.empty())
         {
             throw AdapterNotExistException(id);
@@ -1335,11 +1634,9 @@ Database::getFilteredAdapterInfo(const string& id, const Ice::ConnectionPtr& con
     // Otherwise, we check the adapter endpoint table -- if there's an
     // entry the adapter is managed by the registry itself.
     //
-    IceDB::ReadOnlyTxn txn(_env);
-
     AdapterInfo info;
     AdapterInfoSeq infos;
-    if(_adapters.get(txn, id, info))
+    if(_adapterIndex.get(id, info))
     {
         infos.push_back(info);
     }
@@ -1349,7 +1646,7 @@ Database::getFilteredAdapterInfo(const string& id, const Ice::ConnectionPtr& con
         // If it's not a regular object adapter, perhaps it's a replica
         // group...
         //
-        infos = findByReplicaGroupId(txn, _adapters, _adaptersByGroupId, id);
+        infos = _adapterIndex.getByReplicaGroupId(id);
         if(infos.empty())
         {
             throw AdapterNotExistException(id);
@@ -1476,6 +1773,7 @@ Database::addObject(const ObjectInfo& info)
             dbSerial = updateSerial(txn, objectsDbName);
 
             txn.commit();
+            _objectIndex.put(info);
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -1514,9 +1812,8 @@ Database::addOrUpdateObject(const ObjectInfo& info, Ice::Long dbSerial)
         {
             IceDB::ReadWriteTxn txn(_env);
 
-            Ice::Identity k;
             ObjectInfo v;
-            update = _objects.get(txn, k, v);
+            update = _objects.get(txn, id, v);
             if(update)
             {
                 _objectsByType.del(txn, v.type, v.proxy->ice_getIdentity());
@@ -1525,6 +1822,7 @@ Database::addOrUpdateObject(const ObjectInfo& info, Ice::Long dbSerial)
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
             txn.commit();
+            _objectIndex.put(info);
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -1578,6 +1876,7 @@ Database::removeObject(const Ice::Identity& id, Ice::Long dbSerial)
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
             txn.commit();
+            _objectIndex.remove(id);
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -1628,6 +1927,7 @@ Database::updateObject(const Ice::ObjectPrx& proxy)
             dbSerial = updateSerial(txn, objectsDbName);
 
             txn.commit();
+            _objectIndex.put(info);
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -1663,6 +1963,11 @@ Database::addOrUpdateRegistryWellKnownObjects(const ObjectInfoSeq& objects)
             addObject(txn, *p, false);
         }
         txn.commit();
+
+        for(ObjectInfoSeq::const_iterator p = objects.begin(); p != objects.end(); ++p)
+        {
+            _objectIndex.put(*p);
+        }
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1690,6 +1995,11 @@ Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
             }
         }
         txn.commit();
+
+        for(ObjectInfoSeq::const_iterator p = objects.begin(); p != objects.end(); ++p)
+        {
+            _objectIndex.remove(p->proxy->ice_getIdentity());
+        }
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1714,9 +2024,8 @@ Database::getObjectProxy(const Ice::Identity& id)
     {
     }
 
-    IceDB::ReadOnlyTxn txn(_env);
     ObjectInfo info;
-    if(!_objects.get(txn, id, info))
+    if(!_objectIndex.get(id, info))
     {
         throw ObjectNotRegisteredException(id);
     }
@@ -1780,8 +2089,7 @@ Database::getObjectsByType(const string& type, const Ice::ConnectionPtr& con, co
         }
     }
 
-    IceDB::ReadOnlyTxn txn(_env);
-    vector<ObjectInfo> infos = findByType(txn, _objects, _objectsByType, type);
+    vector<ObjectInfo> infos = _objectIndex.getByType(type);
     for(unsigned int i = 0; i < infos.size(); ++i)
     {
         proxies.push_back(infos[i].proxy);
@@ -1813,9 +2121,8 @@ Database::getObjectInfo(const Ice::Identity& id)
     {
     }
 
-    IceDB::ReadOnlyTxn txn(_env);
     ObjectInfo info;
-    if(!_objects.get(txn, id, info))
+    if(!_objectIndex.get(id, info))
     {
         throw ObjectNotRegisteredException(id);
     }
@@ -1829,14 +2136,18 @@ Database::getAllObjectInfos(const string& expression)
 
     IceDB::ReadOnlyTxn txn(_env);
 
-    Ice::Identity id;
-    ObjectInfo info;
+    //
+    // Only decode the objects matching the expression.
+    //
     ObjectsMapROCursor cursor(_objects, txn);
-    while(cursor.get(id, info, MDB_NEXT))
+    const ObjectsMapIterator end;
+    for(ObjectsMapIterator p(cursor); p != end; ++p)
     {
-        if(expression.empty() || IceUtilInternal::match(_communicator->identityToString(id), expression, true))
+        if(expression.empty() ||
+           IceUtilInternal::match(_communicator->identityToString(p->first.value()), expression, true))
         {
-            infos.push_back(info);
+            infos.push_back(ObjectInfo());
+            p->second.read(infos.back());
         }
     }
     return infos;
@@ -1847,8 +2158,7 @@ Database::getObjectInfosByType(const string& type)
 {
     ObjectInfoSeq infos = _objectCache.getAllByType(type);
 
-    IceDB::ReadOnlyTxn txn(_env);
-    ObjectInfoSeq dbInfos = findByType(txn, _objects, _objectsByType, type);
+    ObjectInfoSeq dbInfos = _objectIndex.getByType(type);
     for(unsigned int i = 0; i < dbInfos.size(); ++i)
     {
         infos.push_back(dbInfos[i]);
@@ -1878,6 +2188,7 @@ Database::addInternalObject(const ObjectInfo& info, bool replace)
         addObject(txn, info, true);
 
         txn.commit();
+        _internalObjectIndex.put(info);
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1903,6 +2214,7 @@ Database::removeInternalObject(const Ice::Identity& id)
         deleteObject(txn, info, true);
 
         txn.commit();
+        _internalObjectIndex.remove(id);
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1916,8 +2228,7 @@ Database::getInternalObjectsByType(const string& type)
 {
     Ice::ObjectProxySeq proxies;
 
-    IceDB::ReadOnlyTxn txn(_env);
-    vector<ObjectInfo> infos = findByType(txn, _internalObjects, _internalObjectsByType, type);
+    vector<ObjectInfo> infos = _internalObjectIndex.getByType(type);
     for(unsigned int i = 0; i < infos.size(); ++i)
     {
         proxies.push_back(infos[i].proxy);
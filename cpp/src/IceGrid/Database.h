@@ -57,6 +57,69 @@ typedef IceDB::Dbi<std::string, std::string, IceDB::IceContext, Ice::OutputStrea
 
 typedef IceDB::Dbi<std::string, Ice::Long, IceDB::IceContext, Ice::OutputStream> StringLongMap;
 
+//
+// Decoded copy of the adapters registered with the locator registry
+// or the admin interface. Locator queries are answered from this index
+// instead of reading and unmarshaling the database records. The
+// database updates it once the write transactions are committed.
+//
+class AdapterInfoIndex : public IceUtil::Mutex
+{
+public:
+
+    void put(const AdapterInfo&);
+    void remove(const std::string&);
+    void reset(const AdapterInfoSeq&);
+
+    bool get(const std::string&, AdapterInfo&) const;
+    AdapterInfoSeq getByReplicaGroupId(const std::string&) const;
+
+private:
+
+    std::map<std::string, AdapterInfo> _adapters;
+    std::map<std::string, std::set<std::string> > _adaptersByGroupId;
+};
+
+//
+// Decoded copy of the well-known objects stored in the database, see
+// AdapterInfoIndex above.
+//
+class ObjectInfoIndex : public IceUtil::Mutex
+{
+public:
+
+    void put(const ObjectInfo&);
+    void remove(const Ice::Identity&);
+    void reset(const ObjectInfoSeq&);
+
+    bool get(const Ice::Identity&, ObjectInfo&) const;
+    ObjectInfoSeq getByType(const std::string&) const;
+
+private:
+
+    std::map<Ice::Identity, ObjectInfo> _objects;
+    std::map<std::string, std::set<Ice::Identity> > _objectsByType;
+};
+
+//
+// The group commit of the database, batches are committed with the
+// database locked to serialize them with the other database updates.
+//
+class DatabaseGroupCommit : public IceDB::GroupCommit
+{
+public:
+
+    DatabaseGroupCommit(const IceDB::Env&, IceUtil::Monitor<IceUtil::Mutex>&, const IceUtil::Time&);
+
+protected:
+
+    virtual void commit(const std::vector<IceDB::GroupWrite*>&, int&);
+
+private:
+
+    IceUtil::Monitor<IceUtil::Mutex>& _database;
+};
+
 class Database : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
@@ -200,6 +263,9 @@ private:
 
     friend struct AddComponent;
 
+    class AdapterDirectProxyWrite;
+    friend class AdapterDirectProxyWrite;
+
     static const std::string _applicationDbName;
     static const std::string _objectDbName;
     static const std::string _internalObjectDbName;
@@ -229,6 +295,7 @@ private:
 
     IceUtilInternal::FileLock _dbLock;
     IceDB::Env _env;
+    DatabaseGroupCommit _groupCommit;
 
     StringApplicationInfoMap _applications;
 
@@ -241,6 +308,10 @@ private:
     IdentityObjectInfoMap _internalObjects;
     StringIdentityMap _internalObjectsByType;
 
+    AdapterInfoIndex _adapterIndex;
+    ObjectInfoIndex _objectIndex;
+    ObjectInfoIndex _internalObjectIndex;
+
     StringLongMap _serials;
 
     RegistryPluginFacadeIPtr _pluginFacade;
@@ -2709,9 +2709,10 @@ ApplicationHelper::ApplicationHelper(const Ice::CommunicatorPtr& communicator,
             if(al)
             {
                 al->loadSample = resolve(al->loadSample, "replica group load sample");
-                if(al->loadSample != "" && al->loadSample != "1" && al->loadSample != "5" && al->loadSample != "15")
+                if(al->loadSample != "" && al->loadSample != "1" && al->loadSample != "5" && al->loadSample != "15" &&
+                   al->loadSample != "dispatch")
                 {
-                    resolve.exception("invalid load sample value (allowed values are 1, 5 or 15)");
+                    resolve.exception("invalid load sample value (allowed values are 1, 5, 15 or dispatch)");
                 }
             }
             _instance.replicaGroups.push_back(desc);
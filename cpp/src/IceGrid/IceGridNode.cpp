@@ -467,6 +467,11 @@ NodeService::startImpl(int argc, char* argv[], int& status)
     //
     _node->getPlatformInfo().start();
 
+    //
+    // Start reporting the dispatch load of the servers if enabled.
+    //
+    _node->startDispatchLoadReports();
+
     //
     // Ensures that the locator is reachable.
     //
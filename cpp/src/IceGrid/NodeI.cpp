@@ -277,6 +277,112 @@ private:
     AdapterDynamicInfo _info;
 };
 
+//
+// The metrics view added to the configuration of the servers to
+// compute their dispatch load. It only monitors the dispatch of
+// requests on the server object adapters, the dispatch of the node
+// requests on the Ice.Admin adapter is ignored.
+//
+const string dispatchLoadView = "IceGrid";
+
+class DispatchLoadCollector : public IceUtil::Mutex, public IceUtil::Shared
+{
+public:
+
+    DispatchLoadCollector(const NodeIPtr& node, size_t count) : _node(node), _count(count)
+    {
+        assert(_count > 0);
+    }
+
+    void
+    add(const string& id, const IceMX::MetricsMap& metrics)
+    {
+        {
+            Lock sync(*this);
+            _metrics.insert(make_pair(id, metrics));
+        }
+        finished();
+    }
+
+    void
+    finished()
+    {
+        {
+            Lock sync(*this);
+            if(--_count > 0)
+            {
+                return;
+            }
+        }
+        _node->reportDispatchLoad(_metrics);
+    }
+
+private:
+
+    const NodeIPtr _node;
+    size_t _count;
+    map<string, IceMX::MetricsMap> _metrics;
+};
+typedef IceUtil::Handle<DispatchLoadCollector> DispatchLoadCollectorPtr;
+
+class DispatchLoadCB : public IceUtil::Shared
+{
+public:
+
+    DispatchLoadCB(const DispatchLoadCollectorPtr& collector, const string& id) : _collector(collector), _id(id)
+    {
+    }
+
+    void
+    response(const IceMX::MetricsView& view, Ice::Long)
+    {
+        IceMX::MetricsView::const_iterator p = view.find("Dispatch");
+        if(p != view.end())
+        {
+            _collector->add(_id, p->second);
+        }
+        else
+        {
+            _collector->finished();
+        }
+    }
+
+    void
+    exception(const Ice::Exception&)
+    {
+        //
+        // The server might not be reachable anymore or its metrics
+        // might be disabled, its dispatch load is not reported.
+        //
+        _collector->finished();
+    }
+
+private:
+
+    const DispatchLoadCollectorPtr _collector;
+    const string _id;
+};
+typedef IceUtil::Handle<DispatchLoadCB> DispatchLoadCBPtr;
+
+class DispatchLoadTask : public IceUtil::TimerTask
+{
+public:
+
+    DispatchLoadTask(const NodeIPtr& node) : _node(node)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _node->collectDispatchLoad();
+    }
+
+private:
+
+    const NodeIPtr _node;
+};
+
 }
 
 NodeI::Update::Update(const NodeIPtr& node, const NodeObserverPrx& observer) : _node(node), _observer(observer)
@@ -313,6 +419,7 @@ NodeI::NodeI(const Ice::ObjectAdapterPtr& adapter,
     _redirectErrToOut(false),
     _allowEndpointsOverride(false),
     _waitTime(0),
+    _dispatchLoadPeriod(0),
     _instanceName(instanceName),
     _userAccountMapper(mapper),
     _platform("IceGrid.Node", _communicator, _traceLevels),
@@ -329,6 +436,20 @@ NodeI::NodeI(const Ice::ObjectAdapterPtr& adapter,
     const_cast<string&>(_outputDir) = props->getProperty("IceGrid.Node.Output");
     const_cast<bool&>(_redirectErrToOut) = props->getPropertyAsInt("IceGrid.Node.RedirectErrToOut") > 0;
     const_cast<bool&>(_allowEndpointsOverride) = props->getPropertyAsInt("IceGrid.Node.AllowEndpointsOverride") > 0;
+    const_cast<int&>(_dispatchLoadPeriod) = props->getPropertyAsInt("IceGrid.Node.DispatchLoadPeriod");
+
+    //
+    // If the node reports the dispatch load of its servers, add a
+    // metrics view to the server configuration to only monitor the
+    // dispatch of the server object adapters.
+    //
+    if(_dispatchLoadPeriod > 0)
+    {
+        const string prefix = "IceMX.Metrics." + dispatchLoadView + ".Map.Dispatch.";
+        _dispatchLoadProperties.push_back(createProperty("# Node dispatch load metrics"));
+        _dispatchLoadProperties.push_back(createProperty(prefix + "GroupBy", "none"));
+        _dispatchLoadProperties.push_back(createProperty(prefix + "Reject.parent", "^Ice.Admin$"));
+    }
 
     //
     // Parse the properties override property.
@@ -835,6 +956,12 @@ NodeI::allowEndpointsOverride() const
     return _allowEndpointsOverride;
 }
 
+const PropertyDescriptorSeq&
+NodeI::getDispatchLoadProperties() const
+{
+    return _dispatchLoadProperties;
+}
+
 NodeSessionPrx
 NodeI::registerWithRegistry(const InternalRegistryPrx& registry)
 {
@@ -1036,6 +1163,144 @@ NodeI::dequeueUpdate(const NodeObserverPrx& proxy, const UpdatePtr& update, bool
     }
 }
 
+void
+NodeI::startDispatchLoadReports()
+{
+    if(_dispatchLoadPeriod > 0)
+    {
+        _timer->scheduleRepeated(new DispatchLoadTask(this), IceUtil::Time::seconds(_dispatchLoadPeriod));
+    }
+}
+
+void
+NodeI::collectDispatchLoad()
+{
+    set<ServerIPtr> servers;
+    {
+        IceUtil::Mutex::Lock sync(_serversLock);
+        for(map<string, set<ServerIPtr> >::const_iterator p = _serversByApplication.begin();
+            p != _serversByApplication.end(); ++p)
+        {
+            servers.insert(p->second.begin(), p->second.end());
+        }
+    }
+
+    vector<pair<string, Ice::ObjectPrx> > processes;
+    for(set<ServerIPtr>::const_iterator p = servers.begin(); p != servers.end(); ++p)
+    {
+        Ice::ObjectPrx process = (*p)->getProcess();
+        if(process)
+        {
+            processes.push_back(make_pair((*p)->getId(), process));
+        }
+    }
+
+    if(processes.empty())
+    {
+        reportDispatchLoad(map<string, IceMX::MetricsMap>());
+        return;
+    }
+
+    //
+    // Get the dispatch metrics of each active server. The invocation
+    // timeout ensures a hung server doesn't prevent the load of the
+    // other servers from being reported.
+    //
+    DispatchLoadCollectorPtr collector = new DispatchLoadCollector(this, processes.size());
+    for(vector<pair<string, Ice::ObjectPrx> >::const_iterator p = processes.begin(); p != processes.end(); ++p)
+    {
+        try
+        {
+            IceMX::MetricsAdminPrx admin = IceMX::MetricsAdminPrx::uncheckedCast(p->second, "Metrics");
+            admin = admin->ice_invocationTimeout(_dispatchLoadPeriod * 1000);
+            admin->begin_getMetricsView(dispatchLoadView,
+                                        IceMX::newCallback_MetricsAdmin_getMetricsView(
+                                            new DispatchLoadCB(collector, p->first),
+                                            &DispatchLoadCB::response,
+                                            &DispatchLoadCB::exception));
+        }
+        catch(const Ice::LocalException&)
+        {
+            collector->finished();
+        }
+    }
+}
+
+void
+NodeI::reportDispatchLoad(const map<string, IceMX::MetricsMap>& metrics)
+{
+    ServerDispatchLoadSeq load;
+    set<NodeSessionPrx> sessions;
+    {
+        IceUtil::Mutex::Lock sync(_observerMutex);
+
+        map<string, DispatchCounters> counters;
+        for(map<string, IceMX::MetricsMap>::const_iterator p = metrics.begin(); p != metrics.end(); ++p)
+        {
+            ServerDispatchLoad l;
+            l.id = p->first;
+            l.current = 0;
+            l.latency = -1.0f;
+
+            DispatchCounters c;
+            c.completed = 0;
+            c.lifetime = 0;
+            for(IceMX::MetricsMap::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+            {
+                l.current += (*q)->current;
+                c.completed += (*q)->total - (*q)->current;
+                c.lifetime += (*q)->totalLifetime;
+            }
+
+            //
+            // The latency is the average lifetime (in microseconds) of
+            // the dispatches completed since the previous report. If
+            // no dispatch completed, keep the previous latency.
+            //
+            DispatchCounters previous = { 0, 0, -1.0f };
+            map<string, DispatchCounters>::const_iterator r = _dispatchCounters.find(p->first);
+            if(r != _dispatchCounters.end() && r->second.completed <= c.completed)
+            {
+                previous = r->second;
+            }
+            if(c.completed > previous.completed)
+            {
+                l.latency = static_cast<float>(c.lifetime - previous.lifetime) /
+                    static_cast<float>(c.completed - previous.completed) / 1000.0f;
+            }
+            else
+            {
+                l.latency = previous.latency;
+            }
+            c.latency = l.latency;
+
+            counters.insert(make_pair(p->first, c));
+            load.push_back(l);
+        }
+        _dispatchCounters.swap(counters);
+
+        for(map<NodeSessionPrx, NodeObserverPrx>::const_iterator p = _observers.begin(); p != _observers.end(); ++p)
+        {
+            sessions.insert(p->first);
+        }
+    }
+
+    //
+    // Send the load to the master and the replicas. Failures are
+    // ignored, the load will be sent again on the next report.
+    //
+    for(set<NodeSessionPrx>::const_iterator p = sessions.begin(); p != sessions.end(); ++p)
+    {
+        try
+        {
+            (*p)->begin_setServersDispatchLoad(load);
+        }
+        catch(const Ice::LocalException&)
+        {
+        }
+    }
+}
+
 void
 NodeI::addServer(const ServerIPtr& server, const string& application)
 {
@@ -11,6 +11,7 @@
 #define ICE_GRID_NODE_I_H
 
 #include <IceUtil/Timer.h>
+#include <Ice/Metrics.h>
 #include <IcePatch2/FileServer.h>
 #include <IceGrid/Internal.h>
 #include <IceGrid/PlatformInfo.h>
@@ -125,6 +126,7 @@ public:
     std::string getOutputDir() const;
     bool getRedirectErrToOut() const;
     bool allowEndpointsOverride() const;
+    const PropertyDescriptorSeq& getDispatchLoadProperties() const;
 
     NodeSessionPrx registerWithRegistry(const InternalRegistryPrx&);
     void checkConsistency(const NodeSessionPrx&);
@@ -137,6 +139,10 @@ public:
     void queueUpdate(const NodeObserverPrx&, const UpdatePtr&);
     void dequeueUpdate(const NodeObserverPrx&, const UpdatePtr&, bool);
 
+    void startDispatchLoadReports();
+    void collectDispatchLoad();
+    void reportDispatchLoad(const std::map<std::string, IceMX::MetricsMap>&);
+
     void addServer(const ServerIPtr&, const std::string&);
     void removeServer(const ServerIPtr&, const std::string&);
 
@@ -171,6 +177,7 @@ private:
     const bool _redirectErrToOut;
     const bool _allowEndpointsOverride;
     const Ice::Int _waitTime;
+    const int _dispatchLoadPeriod;
     const std::string _instanceName;
     const UserAccountMapperPrx _userAccountMapper;
     mutable PlatformInfo _platform;
@@ -179,6 +186,7 @@ private:
     const std::string _tmpDir;
     const FileCachePtr _fileCache;
     PropertyDescriptorSeq _propertiesOverride;
+    PropertyDescriptorSeq _dispatchLoadProperties;
 
     unsigned long _serial;
     bool _consistencyCheckDone;
@@ -190,6 +198,14 @@ private:
 
     std::map<NodeObserverPrx, std::deque<UpdatePtr> > _observerUpdates;
 
+    struct DispatchCounters
+    {
+        Ice::Long completed;
+        Ice::Long lifetime;
+        float latency;
+    };
+    std::map<std::string, DispatchCounters> _dispatchCounters;
+
     IceUtil::Mutex _serversLock;
     std::map<std::string, std::set<ServerIPtr> > _serversByApplication;
     std::set<std::string> _patchInProgress;
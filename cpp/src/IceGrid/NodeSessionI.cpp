@@ -200,6 +200,33 @@ NodeSessionI::keepAlive(const LoadInfo& load, const Ice::Current&)
     }
 }
 
+void
+NodeSessionI::setServersDispatchLoad(const ServerDispatchLoadSeq& load, const Ice::Current&)
+{
+    Lock sync(*this);
+    if(_destroy)
+    {
+        throw Ice::ObjectNotExistException(__FILE__, __LINE__);
+    }
+
+    _dispatchLoadTimestamp = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    _dispatchLoad.clear();
+    for(ServerDispatchLoadSeq::const_iterator p = load.begin(); p != load.end(); ++p)
+    {
+        _dispatchLoad.insert(make_pair(p->id, *p));
+    }
+
+    if(_traceLevels->node > 2)
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->nodeCat);
+        out << "node `" << _info->name << "' dispatch load";
+        for(ServerDispatchLoadSeq::const_iterator p = load.begin(); p != load.end(); ++p)
+        {
+            out << "\nserver `" << p->id << "' (current = " << p->current << ", latency = " << p->latency << "ms)";
+        }
+    }
+}
+
 void
 NodeSessionI::setReplicaObserver(const ReplicaObserverPrx& observer, const Ice::Current&)
 {
@@ -347,6 +374,29 @@ NodeSessionI::getLoadInfo() const
     return _load;
 }
 
+bool
+NodeSessionI::getServerDispatchLoad(const string& id, ServerDispatchLoad& load) const
+{
+    Lock sync(*this);
+
+    //
+    // Ignore the dispatch load if the node stopped reporting it: a
+    // report older than the session timeout is considered stale.
+    //
+    if(_dispatchLoadTimestamp + IceUtil::Time::seconds(_timeout) < IceUtil::Time::now(IceUtil::Time::Monotonic))
+    {
+        return false;
+    }
+
+    map<string, ServerDispatchLoad>::const_iterator p = _dispatchLoad.find(id);
+    if(p == _dispatchLoad.end())
+    {
+        return false;
+    }
+    load = p->second;
+    return true;
+}
+
 NodeSessionPrx
 NodeSessionI::getProxy() const
 {
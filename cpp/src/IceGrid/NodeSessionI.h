@@ -59,6 +59,7 @@ public:
     NodeSessionI(const DatabasePtr&, const NodePrx&, const InternalNodeInfoPtr&, int, const LoadInfo&);
 
     virtual void keepAlive(const LoadInfo&, const Ice::Current&);
+    virtual void setServersDispatchLoad(const ServerDispatchLoadSeq&, const Ice::Current&);
     virtual void setReplicaObserver(const ReplicaObserverPrx&, const Ice::Current&);
     virtual int getTimeout(const Ice::Current&) const;
     virtual NodeObserverPrx getObserver(const Ice::Current&) const;
@@ -76,6 +77,7 @@ public:
     const NodePrx& getNode() const;
     const InternalNodeInfoPtr& getInfo() const;
     const LoadInfo& getLoadInfo() const;
+    bool getServerDispatchLoad(const std::string&, ServerDispatchLoad&) const;
     NodeSessionPrx getProxy() const;
 
     bool isDestroyed() const;
@@ -95,6 +97,8 @@ private:
     ReplicaObserverPrx _replicaObserver;
     IceUtil::Time _timestamp;
     LoadInfo _load;
+    std::map<std::string, ServerDispatchLoad> _dispatchLoad;
+    IceUtil::Time _dispatchLoadTimestamp;
     bool _destroy;
     std::set<PatcherFeedbackPtr> _feedbacks;
 };
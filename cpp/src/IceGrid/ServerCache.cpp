@@ -13,6 +13,7 @@
 #include <Ice/LocalException.h>
 #include <IceGrid/ServerCache.h>
 #include <IceGrid/NodeCache.h>
+#include <IceGrid/NodeSessionI.h>
 #include <IceGrid/AdapterCache.h>
 #include <IceGrid/ObjectCache.h>
 #include <IceGrid/AllocatableObjectCache.h>
@@ -664,6 +665,29 @@ ServerEntry::getLoad(LoadSample sample) const
     }
 }
 
+bool
+ServerEntry::getDispatchLoad(ServerDispatchLoad& load) const
+{
+    string node;
+    {
+        Lock sync(*this);
+        if(_loaded.get())
+        {
+            node = _loaded->node;
+        }
+        else if(_load.get())
+        {
+            node = _load->node;
+        }
+        else
+        {
+            throw ServerNotExistException();
+        }
+    }
+
+    return _cache.getNodeCache().get(node)->getSession()->getServerDispatchLoad(_id, load);
+}
+
 void
 ServerEntry::syncImpl()
 {
@@ -91,6 +91,7 @@ public:
     AdapterPrx getAdapter(const std::string&, bool);
     AdapterPrx getAdapter(int&, int&, const std::string&, bool);
     float getLoad(LoadSample) const;
+    bool getDispatchLoad(ServerDispatchLoad&) const;
 
     bool canRemove();
     CheckUpdateResultPtr checkUpdate(const ServerInfo&, bool);
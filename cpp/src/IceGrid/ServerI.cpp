@@ -3204,6 +3204,16 @@ ServerI::getProperties(const InternalServerDescriptorPtr& desc)
         }
     }
 
+    //
+    // Add the metrics view used by the node to report the server
+    // dispatch load, the node gets the metrics from the admin facet.
+    //
+    if(desc->processRegistered)
+    {
+        const PropertyDescriptorSeq& dispatchLoadProps = _node->getDispatchLoadProperties();
+        props.insert(props.end(), dispatchLoadProps.begin(), dispatchLoadProps.end());
+    }
+
     //
     // Add the locator proxy property and the node properties override
     //
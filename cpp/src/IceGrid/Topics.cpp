@@ -27,10 +27,193 @@ Ice::EncodingVersion encodings[] = {
     { 1, 1 }
 };
 
+size_t
+getUpdatesMax(const Ice::CommunicatorPtr& communicator)
+{
+    Ice::Int size = communicator->getProperties()->getPropertyAsIntWithDefault("IceGrid.Registry.ReplicationLogSize",
+                                                                               1000);
+    return size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+class ApplicationAddedUpdate : public ObserverTopic::Update
+{
+public:
+
+    ApplicationAddedUpdate(const ApplicationInfo& info) : _info(info)
+    {
+    }
+
+    virtual void
+    publish(const Ice::ObjectPrx& publisher, int serial, const Ice::Context& context) const
+    {
+        ApplicationObserverPrx::uncheckedCast(publisher)->applicationAdded(serial, _info, context);
+    }
+
+private:
+
+    const ApplicationInfo _info;
+};
+
+class ApplicationRemovedUpdate : public ObserverTopic::Update
+{
+public:
+
+    ApplicationRemovedUpdate(const string& name) : _name(name)
+    {
+    }
+
+    virtual void
+    publish(const Ice::ObjectPrx& publisher, int serial, const Ice::Context& context) const
+    {
+        ApplicationObserverPrx::uncheckedCast(publisher)->applicationRemoved(serial, _name, context);
+    }
+
+private:
+
+    const string _name;
+};
+
+class ApplicationUpdatedUpdate : public ObserverTopic::Update
+{
+public:
+
+    ApplicationUpdatedUpdate(const ApplicationUpdateInfo& info) : _info(info)
+    {
+    }
+
+    virtual void
+    publish(const Ice::ObjectPrx& publisher, int serial, const Ice::Context& context) const
+    {
+        ApplicationObserverPrx::uncheckedCast(publisher)->applicationUpdated(serial, _info, context);
+    }
+
+private:
+
+    const ApplicationUpdateInfo _info;
+};
+
+class AdapterAddedUpdate : public ObserverTopic::Update
+{
+public:
+
+    AdapterAddedUpdate(const AdapterInfo& info) : _info(info)
+    {
+    }
+
+    virtual void
+    publish(const Ice::ObjectPrx& publisher, int, const Ice::Context& context) const
+    {
+        AdapterObserverPrx::uncheckedCast(publisher)->adapterAdded(_info, context);
+    }
+
+private:
+
+    const AdapterInfo _info;
+};
+
+class AdapterUpdatedUpdate : public ObserverTopic::Update
+{
+public:
+
+    AdapterUpdatedUpdate(const AdapterInfo& info) : _info(info)
+    {
+    }
+
+    virtual void
+    publish(const Ice::ObjectPrx& publisher, int, const Ice::Context& context) const
+    {
+        AdapterObserverPrx::uncheckedCast(publisher)->adapterUpdated(_info, context);
+    }
+
+private:
+
+    const AdapterInfo _info;
+};
+
+class AdapterRemovedUpdate : public ObserverTopic::Update
+{
+public:
+
+    AdapterRemovedUpdate(const string& id) : _id(id)
+    {
+    }
+
+    virtual void
+    publish(const Ice::ObjectPrx& publisher, int, const Ice::Context& context) const
+    {
+        AdapterObserverPrx::uncheckedCast(publisher)->adapterRemoved(_id, context);
+    }
+
+private:
+
+    const string _id;
+};
+
+class ObjectAddedUpdate : public ObserverTopic::Update
+{
+public:
+
+    ObjectAddedUpdate(const ObjectInfo& info) : _info(info)
+    {
+    }
+
+    virtual void
+    publish(const Ice::ObjectPrx& publisher, int, const Ice::Context& context) const
+    {
+        ObjectObserverPrx::uncheckedCast(publisher)->objectAdded(_info, context);
+    }
+
+private:
+
+    const ObjectInfo _info;
+};
+
+class ObjectUpdatedUpdate : public ObserverTopic::Update
+{
+public:
+
+    ObjectUpdatedUpdate(const ObjectInfo& info) : _info(info)
+    {
+    }
+
+    virtual void
+    publish(const Ice::ObjectPrx& publisher, int, const Ice::Context& context) const
+    {
+        ObjectObserverPrx::uncheckedCast(publisher)->objectUpdated(_info, context);
+    }
+
+private:
+
+    const ObjectInfo _info;
+};
+
+class ObjectRemovedUpdate : public ObserverTopic::Update
+{
+public:
+
+    ObjectRemovedUpdate(const Ice::Identity& id) : _id(id)
+    {
+    }
+
+    virtual void
+    publish(const Ice::ObjectPrx& publisher, int, const Ice::Context& context) const
+    {
+        ObjectObserverPrx::uncheckedCast(publisher)->objectRemoved(_id, context);
+    }
+
+private:
+
+    const Ice::Identity _id;
+};
+
 }
 
 ObserverTopic::ObserverTopic(const IceStorm::TopicManagerPrx& topicManager, const string& name, Ice::Long dbSerial) :
-    _logger(topicManager->ice_getCommunicator()->getLogger()), _serial(0), _dbSerial(dbSerial)
+    _logger(topicManager->ice_getCommunicator()->getLogger()),
+    _serial(0),
+    _dbSerial(dbSerial),
+    _updatesMax(getUpdatesMax(topicManager->ice_getCommunicator())),
+    _updatesStart(dbSerial)
 {
     for(int i = 0; i < static_cast<int>(sizeof(encodings) / sizeof(Ice::EncodingVersion)); ++i)
     {
@@ -61,7 +244,7 @@ ObserverTopic::~ObserverTopic()
 }
 
 int
-ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name)
+ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name, Ice::Long dbSerial)
 {
     Lock sync(*this);
     if(_topics.empty())
@@ -70,6 +253,7 @@ ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name)
     }
 
     assert(obsv);
+    int sent = -1;
     try
     {
         IceStorm::QoS qos;
@@ -82,7 +266,21 @@ ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name)
             out << "unsupported encoding version for observer `" << obsv << "'";
             return -1;
         }
-        initObserver(p->second->subscribeAndGetPublisher(qos, obsv->ice_twoway()));
+        Ice::ObjectPrx publisher = p->second->subscribeAndGetPublisher(qos, obsv->ice_twoway());
+
+        //
+        // If the subscriber provided the database serial it's synchronized
+        // with, try to only send the updates it missed. Otherwise, or if
+        // the update log doesn't go back far enough, send the whole set.
+        //
+        if(dbSerial > 0)
+        {
+            sent = publishUpdates(publisher, dbSerial);
+        }
+        if(sent < 0)
+        {
+            initObserver(publisher);
+        }
     }
     catch(const IceStorm::AlreadySubscribed&)
     {
@@ -93,6 +291,10 @@ ObserverTopic::subscribe(const Ice::ObjectPrx& obsv, const string& name)
     {
         assert(_syncSubscribers.find(name) == _syncSubscribers.end());
         _syncSubscribers.insert(name);
+        if(sent == 0)
+        {
+            return -1; // The subscriber is up to date, no update to wait for.
+        }
         addExpectedUpdate(_serial, name);
         return _serial;
     }
@@ -270,6 +472,86 @@ ObserverTopic::updateSerial(Ice::Long dbSerial)
     }
 }
 
+void
+ObserverTopic::logUpdate(Ice::Long dbSerial, const UpdatePtr& update)
+{
+    // Must be called with the lock held and after updateSerial().
+    if(_updatesMax == 0)
+    {
+        return;
+    }
+
+    if(dbSerial < 0)
+    {
+        //
+        // The update doesn't come with a database serial, updates up to
+        // the current serial can't be replayed anymore.
+        //
+        clearUpdates();
+        ++_updatesStart;
+        return;
+    }
+
+    //
+    // Updates which don't increase the database serial (registry
+    // well-known objects) are logged with the current serial.
+    //
+    LogEntry entry;
+    entry.dbSerial = dbSerial > 0 ? dbSerial : _dbSerial;
+    entry.serialUpdated = dbSerial > 0;
+    entry.update = update;
+    _updates.push_back(entry);
+
+    while(_updates.size() > _updatesMax)
+    {
+        const LogEntry& front = _updates.front();
+        _updatesStart = max(_updatesStart, front.serialUpdated ? front.dbSerial : front.dbSerial + 1);
+        _updates.pop_front();
+    }
+}
+
+void
+ObserverTopic::clearUpdates()
+{
+    // Must be called with the lock held and after updateSerial().
+    _updates.clear();
+    _updatesStart = _dbSerial;
+}
+
+int
+ObserverTopic::publishUpdates(const Ice::ObjectPrx& publisher, Ice::Long dbSerial)
+{
+    //
+    // Must be called with the lock held. Returns the number of updates
+    // sent or -1 if the log doesn't contain all the updates since the
+    // given database serial.
+    //
+    if(_updatesMax == 0 || dbSerial < _updatesStart || dbSerial > _dbSerial)
+    {
+        return -1;
+    }
+
+    vector<const LogEntry*> entries;
+    for(deque<LogEntry>::const_iterator p = _updates.begin(); p != _updates.end(); ++p)
+    {
+        if(p->serialUpdated ? p->dbSerial > dbSerial : p->dbSerial >= dbSerial)
+        {
+            entries.push_back(&*p);
+        }
+    }
+
+    //
+    // Only the last update is sent with the topic serial, it's the one
+    // the subscriber acknowledges once the updates are applied.
+    //
+    for(vector<const LogEntry*>::const_iterator p = entries.begin(); p != entries.end(); ++p)
+    {
+        int serial = p + 1 == entries.end() ? _serial : -1;
+        (*p)->update->publish(publisher, _serial, getContext(serial, (*p)->serialUpdated ? (*p)->dbSerial : 0));
+    }
+    return static_cast<int>(entries.size());
+}
+
 Ice::Context
 ObserverTopic::getContext(int serial, Ice::Long dbSerial) const
 {
@@ -622,6 +904,7 @@ ApplicationObserverTopic::applicationInit(Ice::Long dbSerial, const ApplicationI
         return -1;
     }
     updateSerial(dbSerial);
+    clearUpdates();
     _applications.clear();
     for(ApplicationInfoSeq::const_iterator p = apps.begin(); p != apps.end(); ++p)
     {
@@ -653,6 +936,7 @@ ApplicationObserverTopic::applicationAdded(Ice::Long dbSerial, const Application
     }
 
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new ApplicationAddedUpdate(info));
     _applications.insert(make_pair(info.descriptor.name, info));
     try
     {
@@ -679,6 +963,7 @@ ApplicationObserverTopic::applicationRemoved(Ice::Long dbSerial, const string& n
         return -1;
     }
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new ApplicationRemovedUpdate(name));
     _applications.erase(name);
     try
     {
@@ -706,6 +991,7 @@ ApplicationObserverTopic::applicationUpdated(Ice::Long dbSerial, const Applicati
     }
 
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new ApplicationUpdatedUpdate(info));
     try
     {
         map<string, ApplicationInfo>::iterator p = _applications.find(info.descriptor.name);
@@ -793,6 +1079,7 @@ AdapterObserverTopic::adapterInit(Ice::Long dbSerial, const AdapterInfoSeq& adpt
         return -1;
     }
     updateSerial(dbSerial);
+    clearUpdates();
     _adapters.clear();
     for(AdapterInfoSeq::const_iterator q = adpts.begin(); q != adpts.end(); ++q)
     {
@@ -823,6 +1110,7 @@ AdapterObserverTopic::adapterAdded(Ice::Long dbSerial, const AdapterInfo& info)
         return -1;
     }
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new AdapterAddedUpdate(info));
     _adapters.insert(make_pair(info.id, info));
     try
     {
@@ -849,6 +1137,7 @@ AdapterObserverTopic::adapterUpdated(Ice::Long dbSerial, const AdapterInfo& info
         return -1;
     }
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new AdapterUpdatedUpdate(info));
     _adapters[info.id] = info;
     try
     {
@@ -875,6 +1164,7 @@ AdapterObserverTopic::adapterRemoved(Ice::Long dbSerial, const string& id)
         return -1;
     }
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new AdapterRemovedUpdate(id));
     _adapters.erase(id);
     try
     {
@@ -921,6 +1211,7 @@ ObjectObserverTopic::objectInit(Ice::Long dbSerial, const ObjectInfoSeq& objects
         return -1;
     }
     updateSerial(dbSerial);
+    clearUpdates();
     _objects.clear();
     for(ObjectInfoSeq::const_iterator r = objects.begin(); r != objects.end(); ++r)
     {
@@ -951,6 +1242,7 @@ ObjectObserverTopic::objectAdded(Ice::Long dbSerial, const ObjectInfo& info)
         return -1;
     }
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new ObjectAddedUpdate(info));
     _objects.insert(make_pair(info.proxy->ice_getIdentity(), info));
     try
     {
@@ -977,6 +1269,7 @@ ObjectObserverTopic::objectUpdated(Ice::Long dbSerial, const ObjectInfo& info)
         return -1;
     }
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new ObjectUpdatedUpdate(info));
     _objects[info.proxy->ice_getIdentity()] = info;
     try
     {
@@ -1003,6 +1296,7 @@ ObjectObserverTopic::objectRemoved(Ice::Long dbSerial, const Ice::Identity& id)
         return -1;
     }
     updateSerial(dbSerial);
+    logUpdate(dbSerial, new ObjectRemovedUpdate(id));
     _objects.erase(id);
     try
     {
@@ -1036,6 +1330,7 @@ ObjectObserverTopic::wellKnownObjectsAddedOrUpdated(const ObjectInfoSeq& infos)
         if(q != _objects.end())
         {
             q->second = *p;
+            logUpdate(0, new ObjectUpdatedUpdate(*p));
             try
             {
                 for(vector<ObjectObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
@@ -1052,6 +1347,7 @@ ObjectObserverTopic::wellKnownObjectsAddedOrUpdated(const ObjectInfoSeq& infos)
         else
         {
             _objects.insert(make_pair(p->proxy->ice_getIdentity(), *p));
+            logUpdate(0, new ObjectAddedUpdate(*p));
             try
             {
                 for(vector<ObjectObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
@@ -1089,6 +1385,7 @@ ObjectObserverTopic::wellKnownObjectsRemoved(const ObjectInfoSeq& infos)
     {
         updateSerial();
         _objects.erase(p->proxy->ice_getIdentity());
+        logUpdate(0, new ObjectRemovedUpdate(p->proxy->ice_getIdentity()));
         try
         {
             for(vector<ObjectObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
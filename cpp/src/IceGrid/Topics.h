@@ -15,6 +15,7 @@
 #include <IceGrid/Internal.h>
 #include <IceGrid/Registry.h>
 #include <set>
+#include <deque>
 
 namespace IceGrid
 {
@@ -26,7 +27,7 @@ public:
     ObserverTopic(const IceStorm::TopicManagerPrx&, const std::string&, Ice::Long = 0);
     virtual ~ObserverTopic();
 
-    int subscribe(const Ice::ObjectPrx&, const std::string& = std::string());
+    int subscribe(const Ice::ObjectPrx&, const std::string& = std::string(), Ice::Long = 0);
     void unsubscribe(const Ice::ObjectPrx&, const std::string& = std::string());
     void destroy();
 
@@ -38,8 +39,32 @@ public:
 
     int getSerial() const;
 
+    //
+    // An update kept in the topic update log. The log allows to only
+    // send to a replica the updates it missed since the database
+    // serial it was last synchronized with.
+    //
+    class Update : public IceUtil::Shared
+    {
+    public:
+
+        virtual void publish(const Ice::ObjectPrx&, int, const Ice::Context&) const = 0;
+    };
+    typedef IceUtil::Handle<Update> UpdatePtr;
+
 protected:
 
+    struct LogEntry
+    {
+        Ice::Long dbSerial;
+        bool serialUpdated;
+        UpdatePtr update;
+    };
+
+    void logUpdate(Ice::Long, const UpdatePtr&);
+    void clearUpdates();
+    int publishUpdates(const Ice::ObjectPrx&, Ice::Long);
+
     void addExpectedUpdate(int, const std::string& = std::string());
     void waitForSyncedSubscribersNoSync(int, const std::string& = std::string());
     void updateSerial(Ice::Long = 0);
@@ -64,6 +89,10 @@ protected:
     std::set<std::string> _syncSubscribers;
     std::map<int, std::set<std::string> > _waitForUpdates;
     std::map<int, std::map<std::string, std::string> > _updateFailures;
+
+    const size_t _updatesMax;
+    std::deque<LogEntry> _updates;
+    Ice::Long _updatesStart;
 };
 typedef IceUtil::Handle<ObserverTopic> ObserverTopicPtr;
 
@@ -14,6 +14,10 @@
 #include <IcePatch2Lib/Util.h>
 #include <iterator>
 
+#ifndef _WIN32
+#   include <unistd.h>
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -109,6 +113,10 @@ usage(const string& appName)
         "-z, --compress          Always compress files.\n"
         "-Z, --no-compress       Never compress files.\n"
         "-i, --case-insensitive  Files must not differ in case only.\n"
+        "-j, --jobs NUM          Compute the checksums with NUM threads (default:\n"
+        "                        the number of processors).\n"
+        "-F, --full              Compute the checksums of all files, not only of\n"
+        "                        the files modified since the last calculation.\n"
         "-V, --verbose           Verbose mode.\n"
         ;
 }
@@ -133,6 +141,8 @@ main(int argc, char* argv[])
     int compress = 1;
     bool verbose;
     bool caseInsensitive;
+    bool incremental;
+    int jobs;
 
     IceUtilInternal::Options opts;
     opts.addOpt("h", "help");
@@ -141,6 +151,8 @@ main(int argc, char* argv[])
     opts.addOpt("Z", "no-compress");
     opts.addOpt("V", "verbose");
     opts.addOpt("i", "case-insensitive");
+    opts.addOpt("j", "jobs", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("F", "full");
 
     vector<string> args;
     try
@@ -182,6 +194,30 @@ main(int argc, char* argv[])
     }
     verbose = opts.isSet("verbose");
     caseInsensitive = opts.isSet("case-insensitive");
+    incremental = !opts.isSet("full");
+
+    if(opts.isSet("jobs"))
+    {
+        string s = opts.optArg("jobs");
+        istringstream is(s);
+        if(!(is >> jobs) || !is.eof() || jobs < 1)
+        {
+            consoleErr << appName << ": invalid number of jobs `" << s << "'" << endl;
+            usage(appName);
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+#ifdef _WIN32
+        SYSTEM_INFO sysInfo;
+        GetSystemInfo(&sysInfo);
+        jobs = static_cast<int>(sysInfo.dwNumberOfProcessors);
+#else
+        jobs = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+        jobs = max(jobs, 1);
+    }
 
     if(args.empty())
     {
@@ -241,7 +277,7 @@ main(int argc, char* argv[])
         if(fileSeq.empty())
         {
             CalcCB calcCB;
-            if(!getFileInfoSeq(absDataDir, compress, verbose ? &calcCB : 0, infoSeq))
+            if(!getFileInfoSeq(absDataDir, compress, verbose ? &calcCB : 0, infoSeq, jobs, incremental))
             {
                 return EXIT_FAILURE;
             }
@@ -255,7 +291,8 @@ main(int argc, char* argv[])
                 LargeFileInfoSeq partialInfoSeq;
 
                 CalcCB calcCB;
-                if(!getFileInfoSeqSubDir(absDataDir, *p, compress, verbose ? &calcCB : 0, partialInfoSeq))
+                if(!getFileInfoSeqSubDir(absDataDir, *p, compress, verbose ? &calcCB : 0, partialInfoSeq, jobs,
+                                         incremental))
                 {
                     return EXIT_FAILURE;
                 }
@@ -28,6 +28,9 @@ IcePatch2::FileServerI::FileServerI(const std::string& dataDir, const LargeFileI
 {
     FileTree0& tree0 = const_cast<FileTree0&>(_tree0);
     getFileTree0(infoSeq, tree0);
+
+    DirectoryTreeMap& tree = const_cast<DirectoryTreeMap&>(_tree);
+    getDirectoryTree(infoSeq, tree);
 }
 
 FileInfoSeq
@@ -70,6 +73,29 @@ IcePatch2::FileServerI::getChecksum(const Current&) const
     return _tree0.checksum;
 }
 
+TreeNodeSeq
+IcePatch2::FileServerI::getTreeNodeSeq(const string& pa, const Current&) const
+{
+    const string path = simplify(pa);
+
+    DirectoryTreeMap::const_iterator p = _tree.find(path.empty() ? string(".") : path);
+    if(p == _tree.end())
+    {
+        throw FileAccessException(string("`") + pa + "' is not a directory of the file set");
+    }
+
+    TreeNodeSeq nodes;
+    nodes.reserve(p->second.entries.size());
+    for(LargeFileInfoSeq::const_iterator q = p->second.entries.begin(); q != p->second.entries.end(); ++q)
+    {
+        TreeNode node;
+        node.info = *q;
+        node.checksum = getTreeChecksum(_tree, *q);
+        nodes.push_back(node);
+    }
+    return nodes;
+}
+
 void
 IcePatch2::FileServerI::getFileCompressed_async(const AMD_FileServer_getFileCompressedPtr& cb,
                                                 const string& pa, Int pos, Int num, const Current&) const
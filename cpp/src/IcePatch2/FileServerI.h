@@ -31,6 +31,8 @@ public:
 
     Ice::ByteSeq getChecksum(const Ice::Current&) const;
 
+    TreeNodeSeq getTreeNodeSeq(const std::string&, const Ice::Current&) const;
+
     void getFileCompressed_async(const AMD_FileServer_getFileCompressedPtr&,
                                  const std::string&,
                                  Ice::Int,
@@ -54,6 +56,7 @@ private:
 
     const std::string _dataDir;
     const IcePatch2Internal::FileTree0 _tree0;
+    const IcePatch2Internal::DirectoryTreeMap _tree;
 };
 
 }
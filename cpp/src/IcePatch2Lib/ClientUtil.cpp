@@ -12,6 +12,7 @@
 #include <IcePatch2/ClientUtil.h>
 #include <IcePatch2Lib/Util.h>
 #include <list>
+#include <set>
 #include <iterator>
 
 using namespace std;
@@ -72,6 +73,10 @@ public:
 private:
 
     void init(const FileServerPrx&);
+    bool getTreeChanges();
+    bool getPartitionChanges(const FileTree0&);
+    void diff(const LargeFileInfoSeq&, const LargeFileInfoSeq&);
+    void getLocalTreeFiles(const DirectoryTreeMap&, const string&, LargeFileInfoSeq&);
     bool removeFiles(const LargeFileInfoSeq&);
     bool updateFiles(const LargeFileInfoSeq&);
     bool updateFilesInternal(const LargeFileInfoSeq&, const DecompressorPtr&);
@@ -334,147 +339,294 @@ PatcherI::prepare()
             return false;
         }
 
-        ByteSeqSeq checksumSeq = _serverCompress->getChecksumSeq();
-        if(checksumSeq.size() != 256)
+        bool useTree = true;
+        try
+        {
+            if(!getTreeChanges())
+            {
+                return false;
+            }
+        }
+        catch(const Ice::OperationNotExistException&)
         {
-            throw runtime_error("server returned illegal value");
+            //
+            // The server doesn't provide the directory tree, compare the
+            // partitions instead.
+            //
+            useTree = false;
+            _removeFiles.clear();
+            _updateFiles.clear();
+            _updateFlags.clear();
         }
 
-        while(true)
+        if(!useTree && !getPartitionChanges(tree0))
         {
-            AsyncResultPtr curCB;
-            AsyncResultPtr nxtCB;
-            try
+            return false;
+        }
+
+        if(!_feedback->fileListEnd())
+        {
+            return false;
+        }
+    }
+
+    sort(_removeFiles.begin(), _removeFiles.end(), FileInfoLess());
+    sort(_updateFiles.begin(), _updateFiles.end(), FileInfoLess());
+    sort(_updateFlags.begin(), _updateFlags.end(), FileInfoLess());
+
+    string pathLog = simplify(_dataDir + '/' + logFile);
+    _log = IceUtilInternal::fopen(pathLog, "w");
+    if(!_log)
+    {
+        throw runtime_error("cannot open `" + pathLog + "' for writing:\n" + IceUtilInternal::lastErrorToString());
+    }
+
+    return true;
+}
+
+bool
+PatcherI::getTreeChanges()
+{
+    DirectoryTreeMap tree;
+    getDirectoryTree(_localFiles, tree);
+
+    //
+    // Walk down the directories whose checksum differs from the server
+    // checksum, keeping a few requests in flight to hide the latency of
+    // the round trips.
+    //
+    const size_t maxPending = 16;
+    list<string> dirs;
+    list<pair<string, AsyncResultPtr> > pending;
+    size_t done = 0;
+    int progress = 0;
+
+    dirs.push_back(".");
+    while(!dirs.empty() || !pending.empty())
+    {
+        while(!dirs.empty() && pending.size() < maxPending)
+        {
+            pending.push_back(make_pair(dirs.front(), _serverCompress->begin_getTreeNodeSeq(dirs.front())));
+            dirs.pop_front();
+        }
+
+        const string dir = pending.front().first;
+        TreeNodeSeq nodes = _serverCompress->end_getTreeNodeSeq(pending.front().second);
+        pending.pop_front();
+
+        LargeFileInfoSeq files;
+        files.reserve(nodes.size());
+        for(TreeNodeSeq::const_iterator p = nodes.begin(); p != nodes.end(); ++p)
+        {
+            files.push_back(p->info);
+        }
+        sort(files.begin(), files.end(), FileInfoLess());
+        files.erase(unique(files.begin(), files.end(), FileInfoEqual()), files.end());
+
+        DirectoryTreeMap::const_iterator localDir = tree.find(dir);
+        const LargeFileInfoSeq localFiles = localDir != tree.end() ? localDir->second.entries : LargeFileInfoSeq();
+        diff(localFiles, files);
+
+        //
+        // Descend into the server directories which are missing or
+        // different locally.
+        //
+        for(TreeNodeSeq::const_iterator p = nodes.begin(); p != nodes.end(); ++p)
+        {
+            if(p->info.size < 0)
             {
-                for(int node0 = 0; node0 < 256; ++node0)
+                DirectoryTreeMap::const_iterator q = tree.find(p->info.path);
+                if(q == tree.end() || q->second.checksum != p->checksum)
                 {
-                    if(tree0.nodes[node0].checksum != checksumSeq[node0])
-                    {
-                        if(!curCB)
-                        {
-                            assert(!nxtCB);
-                            curCB = _useSmallFileAPI ? _serverCompress->begin_getFileInfoSeq(node0) :
-                                                       _serverCompress->begin_getLargeFileInfoSeq(node0);
-                        }
-                        else
-                        {
-                            assert(nxtCB);
-                            swap(nxtCB, curCB);
-                        }
+                    dirs.push_back(p->info.path);
+                }
+            }
+        }
 
-                        int node0Nxt = node0;
+        //
+        // Local directories which no longer exist on the server are
+        // removed with all their contents.
+        //
+        set<string> remoteDirs;
+        for(LargeFileInfoSeq::const_iterator p = files.begin(); p != files.end(); ++p)
+        {
+            if(p->size < 0)
+            {
+                remoteDirs.insert(p->path);
+            }
+        }
+        for(LargeFileInfoSeq::const_iterator p = localFiles.begin(); p != localFiles.end(); ++p)
+        {
+            if(p->size < 0 && remoteDirs.find(p->path) == remoteDirs.end())
+            {
+                getLocalTreeFiles(tree, p->path, _removeFiles);
+            }
+        }
 
-                        do
-                        {
-                            ++node0Nxt;
-                        }
-                        while(node0Nxt < 256 && tree0.nodes[node0Nxt].checksum == checksumSeq[node0Nxt]);
+        //
+        // The number of directories left isn't known in advance, make
+        // sure the progress never goes backwards.
+        //
+        ++done;
+        progress = max(progress, static_cast<int>(done * 100 / (done + dirs.size() + pending.size())));
+        if(!_feedback->fileListProgress(progress))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-                        if(node0Nxt < 256)
-                        {
-                            nxtCB = _useSmallFileAPI ? _serverCompress->begin_getFileInfoSeq(node0Nxt) :
-                                                       _serverCompress->begin_getLargeFileInfoSeq(node0Nxt);
-                        }
+bool
+PatcherI::getPartitionChanges(const FileTree0& tree0)
+{
+    ByteSeqSeq checksumSeq = _serverCompress->getChecksumSeq();
+    if(checksumSeq.size() != 256)
+    {
+        throw runtime_error("server returned illegal value");
+    }
 
-                        LargeFileInfoSeq files;
-                        if(_useSmallFileAPI)
-                        {
-                            FileInfoSeq smallFiles = _serverCompress->end_getFileInfoSeq(curCB);
-                            files.resize(smallFiles.size());
-                            transform(smallFiles.begin(), smallFiles.end(), files.begin(), toLargeFileInfo);
-                        }
-                        else
-                        {
-                            files = _serverCompress->end_getLargeFileInfoSeq(curCB);
-                        }
+    while(true)
+    {
+        AsyncResultPtr curCB;
+        AsyncResultPtr nxtCB;
+        try
+        {
+            for(int node0 = 0; node0 < 256; ++node0)
+            {
+                if(tree0.nodes[node0].checksum != checksumSeq[node0])
+                {
+                    if(!curCB)
+                    {
+                        assert(!nxtCB);
+                        curCB = _useSmallFileAPI ? _serverCompress->begin_getFileInfoSeq(node0) :
+                                                   _serverCompress->begin_getLargeFileInfoSeq(node0);
+                    }
+                    else
+                    {
+                        assert(nxtCB);
+                        swap(nxtCB, curCB);
+                    }
+
+                    int node0Nxt = node0;
 
-                        sort(files.begin(), files.end(), FileInfoLess());
-                        files.erase(unique(files.begin(), files.end(), FileInfoEqual()), files.end());
-
-                        //
-                        // Compute the set of files which were removed.
-                        //
-                        set_difference(tree0.nodes[node0].files.begin(),
-                                       tree0.nodes[node0].files.end(),
-                                       files.begin(),
-                                       files.end(),
-                                       back_inserter(_removeFiles),
-                                       FileInfoWithoutFlagsLess()); // NOTE: We ignore the flags here.
-
-                        //
-                        // Compute the set of files which were updated (either the file contents, flags or both).
-                        //
-                        LargeFileInfoSeq updatedFiles;
-                        updatedFiles.reserve(files.size());
-
-                        set_difference(files.begin(),
-                                       files.end(),
-                                       tree0.nodes[node0].files.begin(),
-                                       tree0.nodes[node0].files.end(),
-                                       back_inserter(updatedFiles),
-                                       FileInfoLess());
-
-                        //
-                        // Compute the set of files whose contents was updated.
-                        //
-                        LargeFileInfoSeq contentsUpdatedFiles;
-                        contentsUpdatedFiles.reserve(files.size());
-
-                        set_difference(files.begin(),
-                                       files.end(),
-                                       tree0.nodes[node0].files.begin(),
-                                       tree0.nodes[node0].files.end(),
-                                       back_inserter(contentsUpdatedFiles),
-                                       FileInfoWithoutFlagsLess()); // NOTE: We ignore the flags here.
-                        copy(contentsUpdatedFiles.begin(), contentsUpdatedFiles.end(), back_inserter(_updateFiles));
-
-                        //
-                        // Compute the set of files whose flags were updated.
-                        //
-                        set_difference(updatedFiles.begin(),
-                                       updatedFiles.end(),
-                                       contentsUpdatedFiles.begin(),
-                                       contentsUpdatedFiles.end(),
-                                       back_inserter(_updateFlags),
-                                       FileInfoLess());
+                    do
+                    {
+                        ++node0Nxt;
                     }
+                    while(node0Nxt < 256 && tree0.nodes[node0Nxt].checksum == checksumSeq[node0Nxt]);
 
-                    if(!_feedback->fileListProgress((node0 + 1) * 100 / 256))
+                    if(node0Nxt < 256)
                     {
-                        return false;
+                        nxtCB = _useSmallFileAPI ? _serverCompress->begin_getFileInfoSeq(node0Nxt) :
+                                                   _serverCompress->begin_getLargeFileInfoSeq(node0Nxt);
                     }
+
+                    LargeFileInfoSeq files;
+                    if(_useSmallFileAPI)
+                    {
+                        FileInfoSeq smallFiles = _serverCompress->end_getFileInfoSeq(curCB);
+                        files.resize(smallFiles.size());
+                        transform(smallFiles.begin(), smallFiles.end(), files.begin(), toLargeFileInfo);
+                    }
+                    else
+                    {
+                        files = _serverCompress->end_getLargeFileInfoSeq(curCB);
+                    }
+
+                    sort(files.begin(), files.end(), FileInfoLess());
+                    files.erase(unique(files.begin(), files.end(), FileInfoEqual()), files.end());
+
+                    diff(tree0.nodes[node0].files, files);
                 }
-            }
-            catch(const Ice::OperationNotExistException&)
-            {
-                if(!_useSmallFileAPI)
+
+                if(!_feedback->fileListProgress((node0 + 1) * 100 / 256))
                 {
-                    _useSmallFileAPI = true;
-                    continue;
+                    return false;
                 }
-                throw;
             }
-            break;
         }
-
-        if(!_feedback->fileListEnd())
+        catch(const Ice::OperationNotExistException&)
         {
-            return false;
+            if(!_useSmallFileAPI)
+            {
+                _useSmallFileAPI = true;
+                continue;
+            }
+            throw;
         }
+        break;
     }
 
-    sort(_removeFiles.begin(), _removeFiles.end(), FileInfoLess());
-    sort(_updateFiles.begin(), _updateFiles.end(), FileInfoLess());
-    sort(_updateFlags.begin(), _updateFlags.end(), FileInfoLess());
+    return true;
+}
 
-    string pathLog = simplify(_dataDir + '/' + logFile);
-    _log = IceUtilInternal::fopen(pathLog, "w");
-    if(!_log)
+void
+PatcherI::diff(const LargeFileInfoSeq& localFiles, const LargeFileInfoSeq& remoteFiles)
+{
+    //
+    // Compute the set of files which were removed.
+    //
+    set_difference(localFiles.begin(),
+                   localFiles.end(),
+                   remoteFiles.begin(),
+                   remoteFiles.end(),
+                   back_inserter(_removeFiles),
+                   FileInfoWithoutFlagsLess()); // NOTE: We ignore the flags here.
+
+    //
+    // Compute the set of files which were updated (either the file contents, flags or both).
+    //
+    LargeFileInfoSeq updatedFiles;
+    updatedFiles.reserve(remoteFiles.size());
+
+    set_difference(remoteFiles.begin(),
+                   remoteFiles.end(),
+                   localFiles.begin(),
+                   localFiles.end(),
+                   back_inserter(updatedFiles),
+                   FileInfoLess());
+
+    //
+    // Compute the set of files whose contents was updated.
+    //
+    LargeFileInfoSeq contentsUpdatedFiles;
+    contentsUpdatedFiles.reserve(remoteFiles.size());
+
+    set_difference(remoteFiles.begin(),
+                   remoteFiles.end(),
+                   localFiles.begin(),
+                   localFiles.end(),
+                   back_inserter(contentsUpdatedFiles),
+                   FileInfoWithoutFlagsLess()); // NOTE: We ignore the flags here.
+    copy(contentsUpdatedFiles.begin(), contentsUpdatedFiles.end(), back_inserter(_updateFiles));
+
+    //
+    // Compute the set of files whose flags were updated.
+    //
+    set_difference(updatedFiles.begin(),
+                   updatedFiles.end(),
+                   contentsUpdatedFiles.begin(),
+                   contentsUpdatedFiles.end(),
+                   back_inserter(_updateFlags),
+                   FileInfoLess());
+}
+
+void
+PatcherI::getLocalTreeFiles(const DirectoryTreeMap& tree, const string& path, LargeFileInfoSeq& files)
+{
+    DirectoryTreeMap::const_iterator p = tree.find(path);
+    if(p != tree.end())
     {
-        throw runtime_error("cannot open `" + pathLog + "' for writing:\n" + IceUtilInternal::lastErrorToString());
+        for(LargeFileInfoSeq::const_iterator q = p->second.entries.begin(); q != p->second.entries.end(); ++q)
+        {
+            files.push_back(*q);
+            if(q->size < 0)
+            {
+                getLocalTreeFiles(tree, q->path, files);
+            }
+        }
     }
-
-    return true;
 }
 
 bool
@@ -746,9 +746,360 @@ IcePatch2Internal::setFileFlags(const string&, const LargeFileInfo&)
 namespace
 {
 
-static bool
+//
+// A regular file to checksum, and to compress if doCompress is set.
+//
+struct ChecksumJob
+{
+    std::string relPath;
+    std::string path;
+    Ice::Long size;
+    bool doCompress;
+    LargeFileInfo info;
+};
+typedef vector<ChecksumJob> ChecksumJobSeq;
+
+//
+// The checksums of the last checksum file, used to skip the files that
+// didn't change since it was saved.
+//
+struct SavedFileInfos
+{
+    SavedFileInfos() :
+        enabled(false),
+        time(0)
+    {
+    }
+
+    bool enabled;
+    time_t time;
+    map<string, LargeFileInfo> infos;
+};
+
+void
+loadSavedFileInfos(const string& basePath, SavedFileInfos& saved)
+{
+    IceUtilInternal::structstat buf;
+    if(IceUtilInternal::stat(simplify(basePath + '/' + checksumFile), &buf) == -1)
+    {
+        return;
+    }
+
+    LargeFileInfoSeq infoSeq;
+    try
+    {
+        loadFileInfoSeq(basePath, infoSeq);
+    }
+    catch(const exception&)
+    {
+        return;
+    }
+
+    for(LargeFileInfoSeq::const_iterator p = infoSeq.begin(); p != infoSeq.end(); ++p)
+    {
+        if(p->size >= 0)
+        {
+            saved.infos.insert(make_pair(p->path, *p));
+        }
+    }
+    saved.time = buf.st_mtime;
+    saved.enabled = true;
+}
+
+bool
+findSavedFileInfo(const SavedFileInfos& saved, const IceUtilInternal::structstat& buf, LargeFileInfo& info)
+{
+    if(!saved.enabled)
+    {
+        return false;
+    }
+
+    //
+    // The file must be strictly older than the checksum file, a file
+    // modified in the same second as the checksum file is recomputed.
+    // On Unix, st_ctime also catches modifications that preserve the
+    // modification time (such as tar or rsync -t).
+    //
+    if(buf.st_mtime >= saved.time)
+    {
+        return false;
+    }
+#ifndef _WIN32
+    if(buf.st_ctime >= saved.time)
+    {
+        return false;
+    }
+#endif
+
+    map<string, LargeFileInfo>::const_iterator p = saved.infos.find(info.path);
+    if(p == saved.infos.end() || p->second.size != info.size || p->second.executable != info.executable)
+    {
+        return false;
+    }
+    info.checksum = p->second.checksum;
+    return true;
+}
+
+void
+computeChecksum(ChecksumJob& job, ByteSeq& bytes)
+{
+    const string& path = job.path;
+    const string& relPath = job.relPath;
+    LargeFileInfo& info = job.info;
+    const bool doCompress = job.doCompress;
+
+    ByteSeq bytesSHA;
+
+    if(relPath.size() + job.size == 0)
+    {
+        bytesSHA.resize(20);
+        fill(bytesSHA.begin(), bytesSHA.end(), 0);
+    }
+    else
+    {
+        IceInternal::SHA1 hasher;
+        if(relPath.size() != 0)
+        {
+            hasher.update(reinterpret_cast<const IceUtil::Byte*>(relPath.c_str()), relPath.size());
+        }
+
+        if(job.size != 0)
+        {
+            int fd = IceUtilInternal::open(path.c_str(), O_BINARY|O_RDONLY);
+            if(fd == -1)
+            {
+                throw runtime_error("cannot open `" + path + "' for reading:\n" + IceUtilInternal::lastErrorToString());
+            }
+
+            const string pathBZ2 = path + ".bz2";
+            const string pathBZ2Temp = path + ".bz2temp";
+            FILE* stdioFile = 0;
+            int bzError = 0;
+            BZFILE* bzFile = 0;
+            if(doCompress)
+            {
+                stdioFile = IceUtilInternal::fopen(simplify(pathBZ2Temp), "wb");
+                if(!stdioFile)
+                {
+                    IceUtilInternal::close(fd);
+                    throw runtime_error("cannot open `" + pathBZ2Temp + "' for writing:\n" + IceUtilInternal::lastErrorToString());
+                }
+
+                bzFile = BZ2_bzWriteOpen(&bzError, stdioFile, 5, 0, 0);
+                if(bzError != BZ_OK)
+                {
+                    string reason = "BZ2_bzWriteOpen failed";
+                    if(bzError == BZ_IO_ERROR)
+                    {
+                        reason += ": " + IceUtilInternal::lastErrorToString();
+                    }
+                    fclose(stdioFile);
+                    IceUtilInternal::close(fd);
+                    throw runtime_error(reason);
+                }
+            }
+
+            //
+            // The file is read in chunks of the size of the given
+            // buffer, the file is never loaded in memory as a whole.
+            //
+            Ice::Long bytesLeft = job.size;
+            while(bytesLeft > 0)
+            {
+                unsigned int size = static_cast<unsigned int>(min(bytesLeft, static_cast<Ice::Long>(bytes.size())));
+#if defined(_MSC_VER)
+                int rs = _read(fd, &bytes[0], size);
+#else
+                ssize_t rs = read(fd, &bytes[0], size);
+#endif
+                if(rs <= 0)
+                {
+                    string reason = rs == 0 ? string("unexpected end of file") : IceUtilInternal::lastErrorToString();
+                    if(doCompress)
+                    {
+                        BZ2_bzWriteClose(&bzError, bzFile, 0, 0, 0);
+                        fclose(stdioFile);
+                    }
+
+                    IceUtilInternal::close(fd);
+                    throw runtime_error("cannot read from `" + path + "':\n" + reason);
+                }
+                size = static_cast<unsigned int>(rs);
+                bytesLeft -= size;
+                if(doCompress)
+                {
+                    BZ2_bzWrite(&bzError, bzFile, const_cast<Byte*>(&bytes[0]), static_cast<int>(size));
+                    if(bzError != BZ_OK)
+                    {
+                        string reason = "BZ2_bzWrite failed";
+                        if(bzError == BZ_IO_ERROR)
+                        {
+                            reason += ": " + IceUtilInternal::lastErrorToString();
+                        }
+                        BZ2_bzWriteClose(&bzError, bzFile, 0, 0, 0);
+                        fclose(stdioFile);
+                        IceUtilInternal::close(fd);
+                        throw runtime_error(reason);
+                    }
+                }
+
+                hasher.update(reinterpret_cast<IceUtil::Byte*>(&bytes[0]), size);
+            }
+
+            IceUtilInternal::close(fd);
+
+            if(doCompress)
+            {
+                BZ2_bzWriteClose(&bzError, bzFile, 0, 0, 0);
+                if(bzError != BZ_OK)
+                {
+                    string reason = "BZ2_bzWriteClose failed";
+                    if(bzError == BZ_IO_ERROR)
+                    {
+                        reason += ": " + IceUtilInternal::lastErrorToString();
+                    }
+                    fclose(stdioFile);
+                    throw runtime_error(reason);
+                }
+
+                fclose(stdioFile);
+
+                rename(pathBZ2Temp, pathBZ2);
+
+                IceUtilInternal::structstat bufBZ2;
+                if(IceUtilInternal::stat(pathBZ2, &bufBZ2) == -1)
+                {
+                    throw runtime_error("cannot stat `" + pathBZ2 + "':\n" + IceUtilInternal::lastErrorToString());
+                }
+
+                info.size = bufBZ2.st_size;
+            }
+        }
+        hasher.finalize(bytesSHA);
+    }
+
+    info.checksum.swap(bytesSHA);
+}
+
+//
+// Computes the checksums of the jobs with a pool of threads. The jobs
+// are assigned to the threads in order and the callback is called by
+// one thread at a time.
+//
+class ChecksumWorkQueue : public IceUtil::Mutex
+{
+public:
+
+    ChecksumWorkQueue(ChecksumJobSeq& jobs, GetFileInfoSeqCB* cb) :
+        _jobs(jobs),
+        _cb(cb),
+        _next(0),
+        _canceled(false)
+    {
+    }
+
+    void
+    run()
+    {
+        ByteSeq bytes(1024 * 1024);
+        while(true)
+        {
+            ChecksumJob* job;
+            {
+                IceUtil::Mutex::Lock sync(*this);
+                if(_canceled || _next == _jobs.size())
+                {
+                    return;
+                }
+                job = &_jobs[_next++];
+
+                if(_cb && ((job->doCompress && !_cb->compress(job->relPath)) || !_cb->checksum(job->relPath)))
+                {
+                    _canceled = true;
+                    return;
+                }
+            }
+
+            try
+            {
+                computeChecksum(*job, bytes);
+            }
+            catch(const exception& ex)
+            {
+                IceUtil::Mutex::Lock sync(*this);
+                if(_error.empty())
+                {
+                    _error = ex.what();
+                }
+                _canceled = true;
+                return;
+            }
+        }
+    }
+
+    bool
+    finished() const
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(!_error.empty())
+        {
+            throw runtime_error(_error);
+        }
+        return !_canceled;
+    }
+
+private:
+
+    ChecksumJobSeq& _jobs;
+    GetFileInfoSeqCB* _cb;
+    size_t _next;
+    bool _canceled;
+    string _error;
+};
+
+class ChecksumThread : public IceUtil::Thread
+{
+public:
+
+    ChecksumThread(ChecksumWorkQueue& queue) :
+        IceUtil::Thread("IcePatch2 checksum thread"),
+        _queue(queue)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _queue.run();
+    }
+
+private:
+
+    ChecksumWorkQueue& _queue;
+};
+
+bool
+computeChecksums(ChecksumJobSeq& jobs, int threads, GetFileInfoSeqCB* cb)
+{
+    ChecksumWorkQueue queue(jobs, cb);
+
+    vector<IceUtil::ThreadControl> controls;
+    for(int i = 1; i < threads && static_cast<size_t>(i) < jobs.size(); ++i)
+    {
+        IceUtil::ThreadPtr thread = new ChecksumThread(queue);
+        controls.push_back(thread->start());
+    }
+    queue.run(); // The calling thread is also a worker.
+    for(vector<IceUtil::ThreadControl>::iterator p = controls.begin(); p != controls.end(); ++p)
+    {
+        p->join();
+    }
+    return queue.finished();
+}
+
+bool
 getFileInfoSeqInternal(const string& basePath, const string& relPath, int compress, GetFileInfoSeqCB* cb,
-                       LargeFileInfoSeq& infoSeq)
+                       const SavedFileInfos& saved, LargeFileInfoSeq& infoSeq, ChecksumJobSeq& jobs)
 {
     if(relPath == checksumFile || relPath == logFile)
     {
@@ -835,7 +1186,8 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
             StringSeq content = readDirectory(path);
             for(StringSeq::const_iterator p = content.begin(); p != content.end() ; ++p)
             {
-                if(!getFileInfoSeqInternal(basePath, simplify(relPath + '/' + *p), compress, cb, infoSeq))
+                if(!getFileInfoSeqInternal(basePath, simplify(relPath + '/' + *p), compress, cb, saved, infoSeq,
+                                           jobs))
                 {
                     return false;
                 }
@@ -843,7 +1195,13 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
         }
         else if(S_ISREG(buf.st_mode))
         {
-            LargeFileInfo info;
+            ChecksumJob job;
+            job.relPath = relPath;
+            job.path = path;
+            job.size = buf.st_size;
+            job.doCompress = false;
+
+            LargeFileInfo& info = job.info;
             info.path = relPath;
             info.size = 0;
 #ifdef _WIN32
@@ -854,7 +1212,6 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
 
             IceUtilInternal::structstat bufBZ2;
             const string pathBZ2 = path + ".bz2";
-            bool doCompress = false;
             if(buf.st_size != 0 && compress > 0)
             {
                 //
@@ -864,12 +1221,7 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
                 //
                 if(compress >= 2 || IceUtilInternal::stat(pathBZ2, &bufBZ2) == -1 || buf.st_mtime >= bufBZ2.st_mtime)
                 {
-                    if(cb && !cb->compress(relPath))
-                    {
-                        return false;
-                    }
-
-                    doCompress = true;
+                    job.doCompress = true;
                 }
                 else
                 {
@@ -877,136 +1229,14 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
                 }
             }
 
-            if(cb && !cb->checksum(relPath))
-            {
-                return false;
-            }
-
-            ByteSeq bytesSHA;
-
-            if(relPath.size() + buf.st_size == 0)
+            if(!job.doCompress && findSavedFileInfo(saved, buf, info))
             {
-                bytesSHA.resize(20);
-                fill(bytesSHA.begin(), bytesSHA.end(), 0);
+                infoSeq.push_back(info);
             }
             else
             {
-                IceInternal::SHA1 hasher;
-                if(relPath.size() != 0)
-                {
-                    hasher.update(reinterpret_cast<const IceUtil::Byte*>(relPath.c_str()), relPath.size());
-                }
-
-                if(buf.st_size != 0)
-                {
-                    int fd = IceUtilInternal::open(path.c_str(), O_BINARY|O_RDONLY);
-                    if(fd == -1)
-                    {
-                        throw runtime_error("cannot open `" + path + "' for reading:\n" + IceUtilInternal::lastErrorToString());
-                    }
-
-                    const string pathBZ2Temp = path + ".bz2temp";
-                    FILE* stdioFile = 0;
-                    int bzError = 0;
-                    BZFILE* bzFile = 0;
-                    if(doCompress)
-                    {
-                        stdioFile = IceUtilInternal::fopen(simplify(pathBZ2Temp), "wb");
-                        if(!stdioFile)
-                        {
-                            IceUtilInternal::close(fd);
-                            throw runtime_error("cannot open `" + pathBZ2Temp + "' for writing:\n" + IceUtilInternal::lastErrorToString());
-                        }
-
-                        bzFile = BZ2_bzWriteOpen(&bzError, stdioFile, 5, 0, 0);
-                        if(bzError != BZ_OK)
-                        {
-                            string reason = "BZ2_bzWriteOpen failed";
-                            if(bzError == BZ_IO_ERROR)
-                            {
-                                reason += ": " + IceUtilInternal::lastErrorToString();
-                            }
-                            fclose(stdioFile);
-                            IceUtilInternal::close(fd);
-                            throw runtime_error(reason);
-                        }
-                    }
-
-                    long bytesLeft = buf.st_size;
-                    while(bytesLeft > 0)
-                    {
-                        ByteSeq bytes(min(bytesLeft, 1024l*1024));
-                        if(
-#if defined(_MSC_VER)
-                            _read(fd, &bytes[0], static_cast<unsigned int>(bytes.size()))
-#else
-                            read(fd, &bytes[0], static_cast<unsigned int>(bytes.size()))
-#endif
-                            == -1)
-                        {
-                            if(doCompress)
-                            {
-                                fclose(stdioFile);
-                            }
-
-                            IceUtilInternal::close(fd);
-                            throw runtime_error("cannot read from `" + path + "':\n" + IceUtilInternal::lastErrorToString());
-                        }
-                        bytesLeft -= static_cast<unsigned int>(bytes.size());
-                        if(doCompress)
-                        {
-                            BZ2_bzWrite(&bzError, bzFile, const_cast<Byte*>(&bytes[0]), static_cast<int>(bytes.size()));
-                            if(bzError != BZ_OK)
-                            {
-                                string reason = "BZ2_bzWrite failed";
-                                if(bzError == BZ_IO_ERROR)
-                                {
-                                    reason += ": " + IceUtilInternal::lastErrorToString();
-                                }
-                                BZ2_bzWriteClose(&bzError, bzFile, 0, 0, 0);
-                                fclose(stdioFile);
-                                IceUtilInternal::close(fd);
-                                throw runtime_error(reason);
-                            }
-                        }
-
-                        hasher.update(reinterpret_cast<IceUtil::Byte*>(&bytes[0]), bytes.size());
-                    }
-
-                    IceUtilInternal::close(fd);
-
-                    if(doCompress)
-                    {
-                        BZ2_bzWriteClose(&bzError, bzFile, 0, 0, 0);
-                        if(bzError != BZ_OK)
-                        {
-                            string reason = "BZ2_bzWriteClose failed";
-                            if(bzError == BZ_IO_ERROR)
-                            {
-                                reason += ": " + IceUtilInternal::lastErrorToString();
-                            }
-                            fclose(stdioFile);
-                            throw runtime_error(reason);
-                        }
-
-                        fclose(stdioFile);
-
-                        rename(pathBZ2Temp, pathBZ2);
-
-                        if(IceUtilInternal::stat(pathBZ2, &bufBZ2) == -1)
-                        {
-                            throw runtime_error("cannot stat `" + pathBZ2 + "':\n" + IceUtilInternal::lastErrorToString());
-                        }
-
-                        info.size = bufBZ2.st_size;
-                    }
-                }
-                hasher.finalize(bytesSHA);
+                jobs.push_back(job);
             }
-
-            info.checksum.swap(bytesSHA);
-
-            infoSeq.push_back(info);
         }
     }
 
@@ -1022,23 +1252,41 @@ IcePatch2Internal::GetFileInfoSeqCB::~GetFileInfoSeqCB()
 
 bool
 IcePatch2Internal::getFileInfoSeq(const string& basePath, int compress, GetFileInfoSeqCB* cb,
-                                  LargeFileInfoSeq& infoSeq)
+                                  LargeFileInfoSeq& infoSeq, int threads, bool incremental)
 {
-    return getFileInfoSeqSubDir(basePath, ".", compress, cb, infoSeq);
+    return getFileInfoSeqSubDir(basePath, ".", compress, cb, infoSeq, threads, incremental);
 }
 
 bool
 IcePatch2Internal::getFileInfoSeqSubDir(const string& basePa, const string& relPa, int compress, GetFileInfoSeqCB* cb,
-                                        LargeFileInfoSeq& infoSeq)
+                                        LargeFileInfoSeq& infoSeq, int threads, bool incremental)
 {
     const string basePath = simplify(basePa);
     const string relPath = simplify(relPa);
 
-    if(!getFileInfoSeqInternal(basePath, relPath, compress, cb, infoSeq))
+    SavedFileInfos saved;
+    if(incremental)
+    {
+        loadSavedFileInfos(basePath, saved);
+    }
+
+    ChecksumJobSeq jobs;
+    if(!getFileInfoSeqInternal(basePath, relPath, compress, cb, saved, infoSeq, jobs))
+    {
+        return false;
+    }
+
+    if(!computeChecksums(jobs, threads, cb))
     {
         return false;
     }
 
+    infoSeq.reserve(infoSeq.size() + jobs.size());
+    for(ChecksumJobSeq::const_iterator p = jobs.begin(); p != jobs.end(); ++p)
+    {
+        infoSeq.push_back(p->info);
+    }
+
     sort(infoSeq.begin(), infoSeq.end(), FileInfoLess());
     infoSeq.erase(unique(infoSeq.begin(), infoSeq.end(), FileInfoEqual()), infoSeq.end());
 
@@ -1241,3 +1489,72 @@ IcePatch2Internal::getFileTree0(const LargeFileInfoSeq& infoSeq, FileTree0& tree
         fill(tree0.checksum.begin(), tree0.checksum.end(), 0);
     }
 }
+
+void
+IcePatch2Internal::getDirectoryTree(const LargeFileInfoSeq& infoSeq, DirectoryTreeMap& tree)
+{
+    tree.clear();
+
+    //
+    // The data directory itself is always part of the tree, even if the
+    // file set doesn't include an entry for it.
+    //
+    tree["."];
+
+    for(LargeFileInfoSeq::const_iterator p = infoSeq.begin(); p != infoSeq.end(); ++p)
+    {
+        if(p->size < 0)
+        {
+            tree[p->path];
+        }
+    }
+
+    for(LargeFileInfoSeq::const_iterator p = infoSeq.begin(); p != infoSeq.end(); ++p)
+    {
+        if(p->path != ".")
+        {
+            string dir = getDirname(p->path);
+            tree[dir.empty() ? string(".") : dir].entries.push_back(*p);
+        }
+    }
+
+    //
+    // A directory sorts after its parent, so computing the checksums in
+    // reverse order computes the checksums of the subdirectories first.
+    //
+    for(DirectoryTreeMap::reverse_iterator p = tree.rbegin(); p != tree.rend(); ++p)
+    {
+        DirectoryTree& dir = p->second;
+        sort(dir.entries.begin(), dir.entries.end(), FileInfoLess());
+        dir.entries.erase(unique(dir.entries.begin(), dir.entries.end(), FileInfoEqual()), dir.entries.end());
+
+        ByteSeq allChecksums;
+        allChecksums.resize(p->first.size() + dir.entries.size() * 21); // 20 bytes for the checksum + 1 byte for the flag
+        copy(p->first.begin(), p->first.end(), allChecksums.begin());
+        ByteSeq::iterator c = allChecksums.begin() + p->first.size();
+
+        for(LargeFileInfoSeq::const_iterator q = dir.entries.begin(); q != dir.entries.end(); ++q, c += 21)
+        {
+            const ByteSeq& checksum = getTreeChecksum(tree, *q);
+            copy(checksum.begin(), checksum.end(), c);
+            *(c + 20) = q->executable;
+        }
+
+        dir.checksum.resize(20);
+        IceInternal::sha1(reinterpret_cast<unsigned char*>(&allChecksums[0]), allChecksums.size(), dir.checksum);
+    }
+}
+
+const ByteSeq&
+IcePatch2Internal::getTreeChecksum(const DirectoryTreeMap& tree, const LargeFileInfo& info)
+{
+    if(info.size < 0)
+    {
+        DirectoryTreeMap::const_iterator p = tree.find(info.path);
+        if(p != tree.end())
+        {
+            return p->second.checksum;
+        }
+    }
+    return info.checksum;
+}
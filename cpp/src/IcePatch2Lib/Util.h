@@ -163,9 +163,16 @@ public:
     virtual bool compress(const std::string&) = 0;
 };
 
-ICEPATCH2_API bool getFileInfoSeq(const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&);
+//
+// The checksums of the regular files are computed by the given number
+// of threads. If incremental is true, files that are older than the
+// checksum file of the data directory keep their saved checksum.
+//
+ICEPATCH2_API bool getFileInfoSeq(const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&,
+                                  int = 1, bool = false);
 
-ICEPATCH2_API bool getFileInfoSeqSubDir(const std::string&, const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&);
+ICEPATCH2_API bool getFileInfoSeqSubDir(const std::string&, const std::string&, int, GetFileInfoSeqCB*,
+                                        IcePatch2::LargeFileInfoSeq&, int = 1, bool = false);
 
 ICEPATCH2_API void saveFileInfoSeq(const std::string&, const IcePatch2::LargeFileInfoSeq&);
 
@@ -194,6 +201,23 @@ struct FileTree0
 
 ICEPATCH2_API void getFileTree0(const IcePatch2::LargeFileInfoSeq&, FileTree0&);
 
+//
+// A directory of the Merkle tree built over the file set. The checksum
+// of a directory covers the checksums and flags of all the files and
+// directories below it, so two trees only need to be compared in the
+// directories whose checksums differ.
+//
+struct DirectoryTree
+{
+    IcePatch2::LargeFileInfoSeq entries; // The files and directories directly in this directory, sorted.
+    Ice::ByteSeq checksum;
+};
+
+typedef std::map<std::string, DirectoryTree> DirectoryTreeMap;
+
+ICEPATCH2_API void getDirectoryTree(const IcePatch2::LargeFileInfoSeq&, DirectoryTreeMap&);
+ICEPATCH2_API const Ice::ByteSeq& getTreeChecksum(const DirectoryTreeMap&, const IcePatch2::LargeFileInfo&);
+
 }
 
 #endif
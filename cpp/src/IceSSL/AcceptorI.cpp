@@ -78,6 +78,22 @@ IceSSL::AcceptorI::accept()
     return _instance->engine()->createTransceiver(_instance, _delegate->accept(), _adapterName, true);
 }
 
+IceInternal::TransceiverPtr
+IceSSL::AcceptorI::tryAccept()
+{
+    if(!_instance->initialized())
+    {
+        return 0;
+    }
+
+    IceInternal::TransceiverPtr del = _delegate->tryAccept();
+    if(!del)
+    {
+        return 0;
+    }
+    return _instance->engine()->createTransceiver(_instance, del, _adapterName, true);
+}
+
 string
 IceSSL::AcceptorI::protocol() const
 {
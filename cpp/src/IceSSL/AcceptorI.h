@@ -36,6 +36,7 @@ public:
     virtual void finishAccept();
 #endif
     virtual IceInternal::TransceiverPtr accept();
+    virtual IceInternal::TransceiverPtr tryAccept();
     virtual std::string protocol() const;
     virtual std::string toString() const;
     virtual std::string toDetailedString() const;
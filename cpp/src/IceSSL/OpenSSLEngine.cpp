@@ -846,6 +846,21 @@ OpenSSL::SSLEngine::initialize()
             }
         }
 
+        //
+        // Enable kernel TLS if requested. OpenSSL hands the session keys to the
+        // kernel after the handshake if the kernel supports the negotiated cipher,
+        // otherwise the connection keeps using user space encryption. Only TLS 1.2
+        // connections bypass SSL_write, see OpenSSL::TransceiverI::initialize.
+        //
+        if(properties->getPropertyAsInt(propPrefix + "KernelTLS") > 0)
+        {
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+            SSL_CTX_set_options(_ctx, SSL_OP_ENABLE_KTLS);
+#else
+            getLogger()->warning("IceSSL: ignoring IceSSL.KernelTLS because OpenSSL doesn't support kernel TLS");
+#endif
+        }
+
         if(securityTraceLevel() >= 1)
         {
             ostringstream os;
@@ -326,6 +326,22 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         _verified = true;
     }
 
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS) && !defined(ICE_USE_IOCP)
+    //
+    // If OpenSSL enabled kernel TLS for sending, application data is written
+    // directly to the socket and encrypted by the kernel. Reads still go through
+    // SSL_read: with kernel TLS for receiving it only gets the records decrypted
+    // by the kernel, and it handles the records which aren't application data.
+    //
+    // This is limited to TLS 1.2. With TLS 1.3, SSL_read can process a KeyUpdate
+    // message which requires SSL_write to send a KeyUpdate reply and to update
+    // the sending key, writing directly to the socket would bypass both. TLS 1.3
+    // connections keep writing with SSL_write, which still uses kernel TLS if
+    // OpenSSL enabled it.
+    //
+    _kernelTLS = SSL_version(_ssl) == TLS1_2_VERSION && BIO_get_ktls_send(SSL_get_wbio(_ssl));
+#endif
+
     _cipher = SSL_get_cipher_name(_ssl); // Nothing needs to be free'd.
     _engine->verifyPeer(_host, ICE_DYNAMIC_CAST(ConnectionInfo, getInfo()), toString());
 
@@ -349,6 +365,13 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
             out << "bits = " << SSL_CIPHER_get_bits(cipher, 0) << "\n";
             out << "protocol = " << SSL_get_version(_ssl) << "\n";
         }
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS) && !defined(ICE_USE_IOCP)
+        if(SSL_get_options(_ssl) & SSL_OP_ENABLE_KTLS)
+        {
+            out << "kernel TLS = " << (BIO_get_ktls_send(SSL_get_wbio(_ssl)) ? "send" : "none");
+            out << (BIO_get_ktls_recv(SSL_get_rbio(_ssl)) ? ", receive" : "") << "\n";
+        }
+#endif
         out << IceInternal::fdToString(SSL_get_fd(_ssl));
     }
 
@@ -416,6 +439,11 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
         return IceInternal::SocketOperationNone;
     }
 
+    if(_kernelTLS)
+    {
+        return _delegate->write(buf);
+    }
+
     //
     // It's impossible for packetSize to be more than an Int.
     //
@@ -524,6 +552,19 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
     return IceInternal::SocketOperationNone;
 }
 
+IceInternal::SocketOperation
+OpenSSL::TransceiverI::gatherWrite(IceInternal::Buffer& first, IceInternal::Buffer& second)
+{
+    //
+    // With kernel TLS, both buffers can be written with a single system call.
+    //
+    if(_kernelTLS)
+    {
+        return _delegate->gatherWrite(first, second);
+    }
+    return IceInternal::Transceiver::gatherWrite(first, second);
+}
+
 IceInternal::SocketOperation
 OpenSSL::TransceiverI::read(IceInternal::Buffer& buf)
 {
@@ -877,7 +918,8 @@ OpenSSL::TransceiverI::TransceiverI(const InstancePtr& instance,
     _delegate(delegate),
     _connected(false),
     _verified(false),
-    _ssl(0)
+    _ssl(0),
+    _kernelTLS(false)
 #ifdef ICE_USE_IOCP
     , _iocpBio(0),
     _sentBytes(0),
@@ -40,6 +40,7 @@ public:
     virtual IceInternal::SocketOperation closing(bool, const Ice::LocalException&);
     virtual void close();
     virtual IceInternal::SocketOperation write(IceInternal::Buffer&);
+    virtual IceInternal::SocketOperation gatherWrite(IceInternal::Buffer&, IceInternal::Buffer&);
     virtual IceInternal::SocketOperation read(IceInternal::Buffer&);
 #ifdef ICE_USE_IOCP
     virtual bool startWrite(IceInternal::Buffer&);
@@ -80,6 +81,12 @@ private:
     bool _verified;
 
     SSL* _ssl;
+
+    //
+    // True if the data is written directly to the socket and encrypted by the
+    // kernel (kernel TLS, TLS 1.2 only).
+    //
+    bool _kernelTLS;
 #ifdef ICE_USE_IOCP
     BIO* _iocpBio;
     IceInternal::Buffer _writeBuffer;
@@ -127,6 +127,8 @@ typedef IceUtil::Handle<Instance> InstancePtr;
 
 typedef IceDB::ReadWriteCursor<SubscriberRecordKey, SubscriberRecord, IceDB::IceContext, Ice::OutputStream>
         SubscriberMapRWCursor;
+typedef IceDB::View<SubscriberRecordKey, IceDB::IceContext, Ice::OutputStream> SubscriberRecordKeyView;
+typedef IceDB::View<SubscriberRecord, IceDB::IceContext, Ice::OutputStream> SubscriberRecordView;
 
 class PersistentInstance : public Instance
 {
@@ -1217,10 +1217,19 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
         {
             _subscriberMap.del(txn, key);
 
+            //
+            // Only decode the keys, the subscriber records aren't needed.
+            //
             SubscriberRecordKey k;
-            SubscriberRecord v;
-            while(cursor.get(k, v, MDB_NEXT) && k.topic == key.topic)
+            SubscriberRecordKeyView kview;
+            SubscriberRecordView vview;
+            while(cursor.get(kview, vview, MDB_NEXT))
             {
+                kview.read(k);
+                if(k.topic != key.topic)
+                {
+                    break;
+                }
                 _subscriberMap.del(txn, k);
             }
         }
@@ -435,17 +435,23 @@ Client::run(int argc, char* argv[])
                 IceDB::Dbi<string, IceGrid::ApplicationInfo, IceDB::IceContext, Ice::OutputStream>
                     applications(txn, "applications", dbContext, 0);
 
-                string name;
-                ApplicationInfo application;
+                //
+                // The records are decoded in place and the keys are only
+                // decoded for the debug output.
+                //
                 IceDB::ReadOnlyCursor<string, IceGrid::ApplicationInfo, IceDB::IceContext, Ice::OutputStream>
                     appCursor(applications, txn);
-                while(appCursor.get(name, application, MDB_NEXT))
+                const IceDB::CursorIterator<string, IceGrid::ApplicationInfo, IceDB::IceContext, Ice::OutputStream>
+                    appEnd;
+                for(IceDB::CursorIterator<string, IceGrid::ApplicationInfo, IceDB::IceContext, Ice::OutputStream>
+                        p(appCursor); p != appEnd; ++p)
                 {
                     if(debug)
                     {
-                        consoleOut << "  APPLICATION = " << name << endl;
+                        consoleOut << "  APPLICATION = " << p->first.value() << endl;
                     }
-                    data.applications.push_back(application);
+                    data.applications.push_back(ApplicationInfo());
+                    p->second.read(data.applications.back());
                 }
                 appCursor.close();
 
@@ -457,16 +463,19 @@ Client::run(int argc, char* argv[])
                 IceDB::Dbi<string, IceGrid::AdapterInfo, IceDB::IceContext, Ice::OutputStream>
                     adapters(txn, "adapters", dbContext, 0);
 
-                AdapterInfo adapter;
                 IceDB::ReadOnlyCursor<string, IceGrid::AdapterInfo, IceDB::IceContext, Ice::OutputStream>
                     adapterCursor(adapters, txn);
-                while(adapterCursor.get(name, adapter, MDB_NEXT))
+                const IceDB::CursorIterator<string, IceGrid::AdapterInfo, IceDB::IceContext, Ice::OutputStream>
+                    adapterEnd;
+                for(IceDB::CursorIterator<string, IceGrid::AdapterInfo, IceDB::IceContext, Ice::OutputStream>
+                        p(adapterCursor); p != adapterEnd; ++p)
                 {
                     if(debug)
                     {
-                        consoleOut << "  ADAPTER = " << name << endl;
+                        consoleOut << "  ADAPTER = " << p->first.value() << endl;
                     }
-                    data.adapters.push_back(adapter);
+                    data.adapters.push_back(AdapterInfo());
+                    p->second.read(data.adapters.back());
                 }
                 adapterCursor.close();
 
@@ -478,17 +487,20 @@ Client::run(int argc, char* argv[])
                 IceDB::Dbi<Identity, IceGrid::ObjectInfo, IceDB::IceContext, Ice::OutputStream>
                     objects(txn, "objects", dbContext, 0);
 
-                Identity id;
-                ObjectInfo object;
+                typedef IceDB::CursorIterator<Identity, IceGrid::ObjectInfo, IceDB::IceContext, Ice::OutputStream>
+                    ObjectIterator;
+                const ObjectIterator objEnd;
+
                 IceDB::ReadOnlyCursor<Identity, IceGrid::ObjectInfo, IceDB::IceContext, Ice::OutputStream>
                     objCursor(objects, txn);
-                while(objCursor.get(id, object, MDB_NEXT))
+                for(ObjectIterator p(objCursor); p != objEnd; ++p)
                 {
                     if(debug)
                     {
-                        consoleOut << "  IDENTITY = " << communicator()->identityToString(id) << endl;
+                        consoleOut << "  IDENTITY = " << communicator()->identityToString(p->first.value()) << endl;
                     }
-                    data.objects.push_back(object);
+                    data.objects.push_back(ObjectInfo());
+                    p->second.read(data.objects.back());
                 }
                 objCursor.close();
 
@@ -502,13 +514,14 @@ Client::run(int argc, char* argv[])
 
                 IceDB::ReadOnlyCursor<Identity, IceGrid::ObjectInfo, IceDB::IceContext, Ice::OutputStream>
                     iobjCursor(internalObjects, txn);
-                while(iobjCursor.get(id, object, MDB_NEXT))
+                for(ObjectIterator p(iobjCursor); p != objEnd; ++p)
                 {
                     if(debug)
                     {
-                        consoleOut << "  IDENTITY = " << communicator()->identityToString(id) << endl;
+                        consoleOut << "  IDENTITY = " << communicator()->identityToString(p->first.value()) << endl;
                     }
-                    data.internalObjects.push_back(object);
+                    data.internalObjects.push_back(ObjectInfo());
+                    p->second.read(data.internalObjects.back());
                 }
                 iobjCursor.close();
 
@@ -520,6 +533,7 @@ Client::run(int argc, char* argv[])
                 IceDB::Dbi<string, Long, IceDB::IceContext, Ice::OutputStream>
                     serials(txn, "serials", dbContext, 0);
 
+                string name;
                 Long serial;
                 IceDB::ReadOnlyCursor<string, Long, IceDB::IceContext, Ice::OutputStream>
                     serialCursor(serials, txn);
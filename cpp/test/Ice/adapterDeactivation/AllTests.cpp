@@ -60,6 +60,35 @@ allTests(const CommunicatorPtr& communicator)
         }
     }
 
+#if !defined(_WIN32) && TARGET_OS_IPHONE == 0
+    {
+        cout << "testing object adapter with several acceptors... " << flush;
+        communicator->getProperties()->setProperty("AcceptorsTestAdapter.Acceptors", "4");
+        ObjectAdapterPtr adpt = communicator->createObjectAdapterWithEndpoints("AcceptorsTestAdapter", "default");
+        test(adpt->getEndpoints().size() == 1);
+        test(adpt->getPublishedEndpoints().size() >= 1);
+        adpt->activate();
+
+        ObjectPrxPtr prx = adpt->createProxy(stringToIdentity("dummy"));
+        for(int i = 0; i < 20; ++i)
+        {
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            Ice::CommunicatorHolder comm(initData);
+            try
+            {
+                comm->stringToProxy(communicator->proxyToString(prx))->ice_ping();
+                test(false);
+            }
+            catch(const ObjectNotExistException&)
+            {
+            }
+        }
+        adpt->destroy();
+        cout << "ok" << endl;
+    }
+#endif
+
     cout << "creating/activating/deactivating object adapter in one operation... " << flush;
     obj->transient();
 #ifdef ICE_CPP11_MAPPING
@@ -651,6 +651,34 @@ private:
 };
 typedef IceUtil::Handle<SentCallback> SentCallbackPtr;
 
+class SentOrderCallback : public Ice::LocalObject
+{
+public:
+
+    void ex(const Ice::Exception&, const CookiePtr&)
+    {
+        test(false);
+    }
+
+    void sent(bool, const CookiePtr& cookie)
+    {
+        IceUtil::Mutex::Lock sync(_m);
+        _order.push_back(cookie->val);
+    }
+
+    vector<int> order()
+    {
+        IceUtil::Mutex::Lock sync(_m);
+        return _order;
+    }
+
+private:
+
+    IceUtil::Mutex _m;
+    vector<int> _order;
+};
+typedef IceUtil::Handle<SentOrderCallback> SentOrderCallbackPtr;
+
 class FlushCallback : public CallbackBase
 {
 public:
@@ -1781,6 +1809,81 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
     }
     cout << "ok" << endl;
 
+    cout << "testing priority requests... " << flush;
+    if(p->ice_getConnection())
+    {
+        //
+        // Queue requests while the server doesn't read from the connection
+        // and check that a priority request is sent ahead of the requests
+        // queued before it.
+        //
+        Ice::ByteSeq seq;
+        seq.resize(1024);
+        mutex m;
+        vector<int> order;
+        auto invoke = [&](int id, const Ice::Context& ctx)
+        {
+            auto s = make_shared<promise<bool>>();
+            p->opWithPayloadAsync(
+                seq,
+                [](){},
+                [s](const exception_ptr& ex)
+                {
+                    s->set_exception(ex);
+                },
+                [&m, &order, s, id](bool value)
+                {
+                    {
+                        lock_guard<mutex> lock(m);
+                        order.push_back(id);
+                    }
+                    s->set_value(value);
+                },
+                ctx);
+            return s->get_future();
+        };
+
+        vector<future<bool>> futures;
+        testController->holdAdapter();
+        try
+        {
+            while(true)
+            {
+                auto f = invoke(0, Ice::noExplicitContext);
+                if(f.wait_for(chrono::seconds(0)) != future_status::ready)
+                {
+                    futures.push_back(move(f));
+                    break;
+                }
+                else if(!f.get())
+                {
+                    break;
+                }
+            }
+
+            for(int i = 0; i < 5; ++i)
+            {
+                futures.push_back(invoke(1, Ice::noExplicitContext));
+            }
+
+            Ice::Context ctx;
+            ctx["_priority"] = "";
+            futures.push_back(invoke(2, ctx));
+        }
+        catch(...)
+        {
+            testController->resumeAdapter();
+            throw;
+        }
+        testController->resumeAdapter();
+        for(auto& f : futures)
+        {
+            f.get();
+        }
+        test(find(order.begin(), order.end(), 2) < find(order.begin(), order.end(), 1));
+    }
+    cout << "ok" << endl;
+
     cout << "testing unexpected exceptions from callback... " << flush;
     {
         auto q = Ice::uncheckedCast<Test::TestIntfPrx>(p->ice_adapterId("dummy"));
@@ -2930,6 +3033,59 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
     }
     cout << "ok" << endl;
 
+    cout << "testing priority requests... " << flush;
+    if(p->ice_getConnection())
+    {
+        //
+        // Queue requests while the server doesn't read from the connection
+        // and check that a priority request is sent ahead of the requests
+        // queued before it.
+        //
+        Ice::ByteSeq seq;
+        seq.resize(1024);
+        SentOrderCallbackPtr cb = new SentOrderCallback();
+        Test::Callback_TestIntf_opWithPayloadPtr callback =
+            Test::newCallback_TestIntf_opWithPayload(cb, &SentOrderCallback::ex, &SentOrderCallback::sent);
+        CookiePtr queued = new Cookie(0);
+        CookiePtr overtaken = new Cookie(1);
+        CookiePtr priority = new Cookie(2);
+
+        vector<Ice::AsyncResultPtr> results;
+        testController->holdAdapter();
+        try
+        {
+            Ice::AsyncResultPtr r;
+            do
+            {
+                r = p->begin_opWithPayload(seq, callback, queued);
+            }
+            while(r->sentSynchronously());
+            results.push_back(r);
+
+            for(int i = 0; i < 5; ++i)
+            {
+                results.push_back(p->begin_opWithPayload(seq, callback, overtaken));
+            }
+
+            Ice::Context ctx;
+            ctx["_priority"] = "";
+            results.push_back(p->begin_opWithPayload(seq, ctx, callback, priority));
+        }
+        catch(...)
+        {
+            testController->resumeAdapter();
+            throw;
+        }
+        testController->resumeAdapter();
+        for(vector<Ice::AsyncResultPtr>::const_iterator r = results.begin(); r != results.end(); ++r)
+        {
+            (*r)->waitForCompleted();
+        }
+        vector<int> order = cb->order();
+        test(find(order.begin(), order.end(), 2) < find(order.begin(), order.end(), 1));
+    }
+    cout << "ok" << endl;
+
     cout << "testing illegal arguments... " << flush;
     {
         Ice::AsyncResultPtr result;
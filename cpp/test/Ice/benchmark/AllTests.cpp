@@ -0,0 +1,548 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <TestI.h>
+#include <algorithm>
+#include <fstream>
+
+//
+// The benchmark measures the invocation, dispatch and marshaling
+// paths of the runtime. It's configured with the following client
+// properties:
+//
+// Benchmark.Iterations    Number of calls for each measurement (default 1000).
+// Benchmark.Transports    Transports to compare (default "collocated tcp ssl ws").
+// Benchmark.PayloadSizes  Payload sizes in bytes for the sweeps (default "1024 16384 262144").
+// Benchmark.Output        File to write the results to as a JSON document.
+//
+// The default iteration count keeps the test suite fast, a meaningful
+// run needs an optimized build and a larger count, for example:
+//
+// python allTests.py --filter=Ice/benchmark --cprops="Benchmark.Iterations=100000 Benchmark.Output=bench.json"
+//
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+struct Result
+{
+    string benchmark;
+    string transport;
+    int size;
+    int iterations;
+    vector<pair<string, double> > values;
+};
+
+class Call
+{
+public:
+
+    virtual ~Call()
+    {
+    }
+
+    virtual void invoke() = 0;
+};
+
+class PingCall : public Call
+{
+public:
+
+    PingCall(const BenchmarkPrxPtr& prx) : _prx(prx)
+    {
+    }
+
+    virtual void invoke()
+    {
+        _prx->ping();
+    }
+
+private:
+
+    const BenchmarkPrxPtr _prx;
+};
+
+class AMIPingCall : public Call
+{
+public:
+
+    AMIPingCall(const BenchmarkPrxPtr& prx) : _prx(prx)
+    {
+    }
+
+    virtual void invoke()
+    {
+#ifdef ICE_CPP11_MAPPING
+        _prx->pingAsync().get();
+#else
+        _prx->end_ping(_prx->begin_ping());
+#endif
+    }
+
+private:
+
+    const BenchmarkPrxPtr _prx;
+};
+
+class SendByteSeqCall : public Call
+{
+public:
+
+    SendByteSeqCall(const BenchmarkPrxPtr& prx, int size) : _prx(prx), _bytes(static_cast<size_t>(size))
+    {
+    }
+
+    virtual void invoke()
+    {
+        _prx->sendByteSeq(make_pair(&_bytes[0], &_bytes[0] + _bytes.size()));
+    }
+
+private:
+
+    const BenchmarkPrxPtr _prx;
+    const ByteSeq _bytes;
+};
+
+class RecvByteSeqCall : public Call
+{
+public:
+
+    RecvByteSeqCall(const BenchmarkPrxPtr& prx, int size) : _prx(prx), _size(size)
+    {
+    }
+
+    virtual void invoke()
+    {
+        _prx->recvByteSeq(_size);
+    }
+
+private:
+
+    const BenchmarkPrxPtr _prx;
+    const int _size;
+};
+
+class EchoFixedSeqCall : public Call
+{
+public:
+
+    EchoFixedSeqCall(const BenchmarkPrxPtr& prx, const FixedSeq& seq) : _prx(prx), _seq(seq)
+    {
+    }
+
+    virtual void invoke()
+    {
+        _prx->echoFixedSeq(_seq);
+    }
+
+private:
+
+    const BenchmarkPrxPtr _prx;
+    const FixedSeq _seq;
+};
+
+class EchoVariableSeqCall : public Call
+{
+public:
+
+    EchoVariableSeqCall(const BenchmarkPrxPtr& prx, const VariableSeq& seq) : _prx(prx), _seq(seq)
+    {
+    }
+
+    virtual void invoke()
+    {
+        _prx->echoVariableSeq(_seq);
+    }
+
+private:
+
+    const BenchmarkPrxPtr _prx;
+    const VariableSeq _seq;
+};
+
+class EchoNodeCall : public Call
+{
+public:
+
+    EchoNodeCall(const BenchmarkPrxPtr& prx, const NodePtr& node) : _prx(prx), _node(node)
+    {
+    }
+
+    virtual void invoke()
+    {
+        _prx->echoNode(_node);
+    }
+
+private:
+
+    const BenchmarkPrxPtr _prx;
+    const NodePtr _node;
+};
+
+IceUtil::Time
+now()
+{
+    return IceUtil::Time::now(IceUtil::Time::Monotonic);
+}
+
+void
+warmup(Call& call, int iterations)
+{
+    for(int i = 0; i < max(iterations / 10, 1); ++i)
+    {
+        call.invoke();
+    }
+}
+
+Result
+measureLatency(Call& call, const string& benchmark, const string& transport, int size, int iterations)
+{
+    warmup(call, iterations);
+
+    vector<IceUtil::Int64> samples;
+    samples.reserve(static_cast<size_t>(iterations));
+    IceUtil::Int64 total = 0;
+    for(int i = 0; i < iterations; ++i)
+    {
+        IceUtil::Time start = now();
+        call.invoke();
+        samples.push_back((now() - start).toMicroSeconds());
+        total += samples.back();
+    }
+    sort(samples.begin(), samples.end());
+
+    Result result;
+    result.benchmark = benchmark;
+    result.transport = transport;
+    result.size = size;
+    result.iterations = iterations;
+    result.values.push_back(make_pair("mean_us", static_cast<double>(total) / iterations));
+    result.values.push_back(make_pair("p50_us", static_cast<double>(samples[samples.size() * 50 / 100])));
+    result.values.push_back(make_pair("p90_us", static_cast<double>(samples[samples.size() * 90 / 100])));
+    result.values.push_back(make_pair("p99_us", static_cast<double>(samples[samples.size() * 99 / 100])));
+    result.values.push_back(make_pair("max_us", static_cast<double>(samples.back())));
+    if(total > 0)
+    {
+        result.values.push_back(make_pair("calls_per_s", iterations * 1000000.0 / total));
+        if(size > 0)
+        {
+            result.values.push_back(make_pair("mb_per_s", static_cast<double>(size) * iterations / total));
+        }
+    }
+    return result;
+}
+
+Result
+throughput(const string& benchmark, const string& transport, int size, int iterations, const IceUtil::Time& elapsed)
+{
+    Result result;
+    result.benchmark = benchmark;
+    result.transport = transport;
+    result.size = size;
+    result.iterations = iterations;
+    IceUtil::Int64 us = max(elapsed.toMicroSeconds(), static_cast<IceUtil::Int64>(1));
+    result.values.push_back(make_pair("total_us", static_cast<double>(us)));
+    result.values.push_back(make_pair("calls_per_s", iterations * 1000000.0 / us));
+    if(size > 0)
+    {
+        result.values.push_back(make_pair("mb_per_s", static_cast<double>(size) * iterations / us));
+    }
+    return result;
+}
+
+Result
+measureOneway(const BenchmarkPrxPtr& prx, const string& transport, int iterations)
+{
+    BenchmarkPrxPtr oneway = prx->ice_oneway();
+    for(int i = 0; i < max(iterations / 10, 1); ++i)
+    {
+        oneway->ping();
+    }
+    prx->ping();
+
+    //
+    // The final twoway call returns once the server dispatched all the
+    // oneway calls sent over the connection.
+    //
+    IceUtil::Time start = now();
+    for(int i = 0; i < iterations; ++i)
+    {
+        oneway->ping();
+    }
+    prx->ping();
+    return throughput("oneway", transport, 0, iterations, now() - start);
+}
+
+Result
+measureBatch(const BenchmarkPrxPtr& prx, const string& transport, int iterations)
+{
+    BenchmarkPrxPtr batch = prx->ice_batchOneway();
+    for(int i = 0; i < max(iterations / 10, 1); ++i)
+    {
+        batch->ping();
+    }
+    batch->ice_flushBatchRequests();
+    prx->ping();
+
+    IceUtil::Time start = now();
+    for(int i = 0; i < iterations; ++i)
+    {
+        batch->ping();
+    }
+    batch->ice_flushBatchRequests();
+    prx->ping();
+    return throughput("batch", transport, 0, iterations, now() - start);
+}
+
+template<typename T> void
+measureMarshal(const Ice::CommunicatorPtr& communicator, const string& type, const T& value, int iterations,
+               vector<Result>& results)
+{
+    //
+    // Classes require the pending values to be written and read, the
+    // calls are no-ops for the other types with the 1.1 encoding.
+    //
+    vector<Ice::Byte> data;
+    {
+        Ice::OutputStream out(communicator);
+        out.write(value);
+        out.writePendingValues();
+        out.finished(data);
+    }
+
+    for(int i = 0; i < max(iterations / 10, 1); ++i)
+    {
+        Ice::OutputStream out(communicator);
+        out.write(value);
+        out.writePendingValues();
+    }
+    IceUtil::Time start = now();
+    for(int i = 0; i < iterations; ++i)
+    {
+        Ice::OutputStream out(communicator);
+        out.write(value);
+        out.writePendingValues();
+    }
+    results.push_back(throughput("marshal " + type, "none", static_cast<int>(data.size()), iterations, now() - start));
+
+    pair<const Ice::Byte*, const Ice::Byte*> bytes(&data[0], &data[0] + data.size());
+    for(int i = 0; i < max(iterations / 10, 1); ++i)
+    {
+        Ice::InputStream in(communicator, bytes);
+        T v;
+        in.read(v);
+        in.readPendingValues();
+    }
+    start = now();
+    for(int i = 0; i < iterations; ++i)
+    {
+        Ice::InputStream in(communicator, bytes);
+        T v;
+        in.read(v);
+        in.readPendingValues();
+    }
+    results.push_back(throughput("unmarshal " + type, "none", static_cast<int>(data.size()), iterations,
+                                 now() - start));
+}
+
+NodePtr
+createTree(int depth, int& value)
+{
+    NodePtr node = ICE_MAKE_SHARED(Node);
+    node->value = value++;
+    if(depth > 1)
+    {
+        node->left = createTree(depth - 1, value);
+        node->right = createTree(depth - 1, value);
+    }
+    return node;
+}
+
+void
+writeResults(const string& file, const vector<Result>& results)
+{
+    ofstream out(file.c_str());
+    if(!out)
+    {
+        cerr << "couldn't open `" << file << "' for writing" << endl;
+        test(false);
+    }
+
+    out << "{\n  \"results\": [";
+    for(vector<Result>::const_iterator p = results.begin(); p != results.end(); ++p)
+    {
+        out << (p == results.begin() ? "\n" : ",\n");
+        out << "    { \"benchmark\": \"" << p->benchmark << "\", \"transport\": \"" << p->transport << "\", "
+            << "\"size\": " << p->size << ", \"iterations\": " << p->iterations;
+        for(vector<pair<string, double> >::const_iterator q = p->values.begin(); q != p->values.end(); ++q)
+        {
+            out << ", \"" << q->first << "\": " << q->second;
+        }
+        out << " }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+}
+
+void
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    Ice::PropertiesPtr properties = communicator->getProperties();
+    const int iterations = properties->getPropertyAsIntWithDefault("Benchmark.Iterations", 1000);
+    test(iterations > 0);
+
+    Ice::StringSeq defaultTransports;
+    defaultTransports.push_back("collocated");
+    defaultTransports.push_back("tcp");
+    defaultTransports.push_back("ssl");
+    defaultTransports.push_back("ws");
+    const Ice::StringSeq transports = properties->getPropertyAsListWithDefault("Benchmark.Transports",
+                                                                               defaultTransports);
+
+    Ice::StringSeq defaultSizes;
+    defaultSizes.push_back("1024");
+    defaultSizes.push_back("16384");
+    defaultSizes.push_back("262144");
+    vector<int> sizes;
+    Ice::StringSeq s = properties->getPropertyAsListWithDefault("Benchmark.PayloadSizes", defaultSizes);
+    for(Ice::StringSeq::const_iterator p = s.begin(); p != s.end(); ++p)
+    {
+        sizes.push_back(atoi(p->c_str()));
+        test(sizes.back() > 0);
+    }
+
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+    BenchmarkPrxPtr collocated = ICE_UNCHECKED_CAST(BenchmarkPrx,
+        adapter->add(ICE_MAKE_SHARED(BenchmarkI), Ice::stringToIdentity("benchmark")));
+    adapter->activate();
+
+    cout << "testing connections... " << flush;
+    vector<pair<string, BenchmarkPrxPtr> > proxies;
+    for(Ice::StringSeq::const_iterator p = transports.begin(); p != transports.end(); ++p)
+    {
+        BenchmarkPrxPtr prx;
+        if(*p == "collocated")
+        {
+            prx = collocated;
+        }
+        else
+        {
+            int num = *p == "tcp" ? 0 : (*p == "ssl" ? 1 : 2);
+            test(*p == "tcp" || *p == "ssl" || *p == "ws");
+            prx = ICE_UNCHECKED_CAST(BenchmarkPrx,
+                communicator->stringToProxy("benchmark:" + getTestEndpoint(communicator, num, *p)));
+        }
+        prx->ice_ping();
+        proxies.push_back(make_pair(*p, prx));
+    }
+    cout << "ok" << endl;
+
+    vector<Result> results;
+
+    cout << "testing twoway latency... " << flush;
+    for(vector<pair<string, BenchmarkPrxPtr> >::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+    {
+        PingCall call(p->second);
+        results.push_back(measureLatency(call, "twoway", p->first, 0, iterations));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing AMI twoway latency... " << flush;
+    for(vector<pair<string, BenchmarkPrxPtr> >::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+    {
+        AMIPingCall call(p->second);
+        results.push_back(measureLatency(call, "ami twoway", p->first, 0, iterations));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing oneway and batch oneway throughput... " << flush;
+    for(vector<pair<string, BenchmarkPrxPtr> >::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+    {
+        results.push_back(measureOneway(p->second, p->first, iterations));
+        results.push_back(measureBatch(p->second, p->first, iterations));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing payload size sweep... " << flush;
+    for(vector<pair<string, BenchmarkPrxPtr> >::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+    {
+        for(vector<int>::const_iterator q = sizes.begin(); q != sizes.end(); ++q)
+        {
+            //
+            // Scale down the number of calls for large payloads to keep
+            // the amount of data transferred for each size comparable.
+            //
+            int n = max(static_cast<int>(static_cast<IceUtil::Int64>(iterations) * 1024 / max(*q, 1024)), 10);
+
+            SendByteSeqCall send(p->second, *q);
+            results.push_back(measureLatency(send, "send bytes", p->first, *q, n));
+
+            RecvByteSeqCall recv(p->second, *q);
+            results.push_back(measureLatency(recv, "receive bytes", p->first, *q, n));
+        }
+    }
+    cout << "ok" << endl;
+
+    FixedSeq fixedSeq(1000);
+    for(FixedSeq::iterator p = fixedSeq.begin(); p != fixedSeq.end(); ++p)
+    {
+        p->i = static_cast<int>(p - fixedSeq.begin());
+        p->j = -p->i;
+        p->d = p->i / 3.0;
+    }
+
+    VariableSeq variableSeq(1000);
+    for(VariableSeq::iterator p = variableSeq.begin(); p != variableSeq.end(); ++p)
+    {
+        p->i = static_cast<int>(p - variableSeq.begin());
+        ostringstream os;
+        os << "variable length string " << p->i;
+        p->s = os.str();
+    }
+
+    int value = 0;
+    NodePtr tree = createTree(7, value);
+
+    cout << "testing structured types... " << flush;
+    for(vector<pair<string, BenchmarkPrxPtr> >::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+    {
+        EchoFixedSeqCall fixed(p->second, fixedSeq);
+        results.push_back(measureLatency(fixed, "echo fixed struct seq", p->first, 0, iterations));
+
+        EchoVariableSeqCall variable(p->second, variableSeq);
+        results.push_back(measureLatency(variable, "echo variable struct seq", p->first, 0, iterations));
+
+        EchoNodeCall node(p->second, tree);
+        results.push_back(measureLatency(node, "echo class graph", p->first, 0, iterations));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing marshaling... " << flush;
+    measureMarshal(communicator, "byte seq", ByteSeq(static_cast<size_t>(sizes.back())), iterations, results);
+    measureMarshal(communicator, "fixed struct seq", fixedSeq, iterations, results);
+    measureMarshal(communicator, "variable struct seq", variableSeq, iterations, results);
+    measureMarshal(communicator, "class graph", tree, iterations, results);
+    cout << "ok" << endl;
+
+    const string output = properties->getProperty("Benchmark.Output");
+    if(!output.empty())
+    {
+        cout << "writing results to `" << output << "'... " << flush;
+        writeResults(output, results);
+        cout << "ok" << endl;
+    }
+
+    adapter->destroy();
+}
@@ -0,0 +1,15 @@
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+$(test)_client_sources  = Test.ice \
+                          Client.cpp \
+                          AllTests.cpp \
+                          TestI.cpp
+
+tests += $(test)
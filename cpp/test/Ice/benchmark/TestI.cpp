@@ -0,0 +1,53 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+void
+BenchmarkI::ping(const Ice::Current&)
+{
+}
+
+void
+BenchmarkI::sendByteSeq(ICE_IN(pair<const Ice::Byte*, const Ice::Byte*>), const Ice::Current&)
+{
+}
+
+Test::ByteSeq
+BenchmarkI::recvByteSeq(Ice::Int size, const Ice::Current&)
+{
+    return Test::ByteSeq(static_cast<size_t>(size));
+}
+
+Test::FixedSeq
+BenchmarkI::echoFixedSeq(ICE_IN(Test::FixedSeq) seq, const Ice::Current&)
+{
+    return seq;
+}
+
+Test::VariableSeq
+BenchmarkI::echoVariableSeq(ICE_IN(Test::VariableSeq) seq, const Ice::Current&)
+{
+    return seq;
+}
+
+Test::NodePtr
+BenchmarkI::echoNode(ICE_IN(Test::NodePtr) n, const Ice::Current&)
+{
+    return n;
+}
+
+void
+BenchmarkI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
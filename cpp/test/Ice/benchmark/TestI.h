@@ -0,0 +1,31 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+class BenchmarkI : public Test::Benchmark
+{
+public:
+
+    virtual void ping(const Ice::Current&);
+
+    virtual void sendByteSeq(ICE_IN(std::pair<const Ice::Byte*, const Ice::Byte*>), const Ice::Current&);
+    virtual Test::ByteSeq recvByteSeq(Ice::Int, const Ice::Current&);
+
+    virtual Test::FixedSeq echoFixedSeq(ICE_IN(Test::FixedSeq), const Ice::Current&);
+    virtual Test::VariableSeq echoVariableSeq(ICE_IN(Test::VariableSeq), const Ice::Current&);
+    virtual Test::NodePtr echoNode(ICE_IN(Test::NodePtr), const Ice::Current&);
+
+    virtual void shutdown(const Ice::Current&);
+};
+
+#endif
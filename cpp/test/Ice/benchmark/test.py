@@ -0,0 +1,18 @@
+# -*- coding: utf-8 -*-
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+#
+# The benchmark compares the transports itself, always load IceSSL for
+# the client and server and don't run it with the other protocols.
+#
+sslProps = lambda process, current: current.testcase.getMapping().getSSLProps(process, current)
+
+TestSuite(__name__, [ClientServerTestCase(client=Client(props=sslProps), server=Server(props=sslProps))],
+          options={ "protocol" : ["tcp"], "compress" : [False], "serialize" : [False], "mx" : [False] })
@@ -91,6 +91,128 @@ createTestIntfPrx(vector<RemoteObjectAdapterPrxPtr>& adapters)
     return ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpoints(endpoints));
 }
 
+//
+// Counts the DNS lookups done by the endpoint host resolver threads, each
+// lookup switches a resolver thread from idle to in use.
+//
+class HostResolverObserverI : public Ice::Instrumentation::ThreadObserver, public IceUtil::Mutex
+{
+public:
+
+    HostResolverObserverI() : _lookups(0)
+    {
+    }
+
+    virtual void
+    attach()
+    {
+    }
+
+    virtual void
+    detach()
+    {
+    }
+
+    virtual void
+    failed(const string&)
+    {
+    }
+
+    virtual void
+    stateChanged(Ice::Instrumentation::ThreadState, Ice::Instrumentation::ThreadState newState)
+    {
+        using namespace Ice::Instrumentation;
+        if(newState == ICE_ENUM(ThreadState, ThreadStateInUseForOther))
+        {
+            IceUtil::Mutex::Lock sync(*this);
+            ++_lookups;
+        }
+    }
+
+    int
+    getLookupCount()
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        return _lookups;
+    }
+
+private:
+
+    int _lookups;
+};
+ICE_DEFINE_PTR(HostResolverObserverIPtr, HostResolverObserverI);
+
+class CommunicatorObserverI : public Ice::Instrumentation::CommunicatorObserver
+{
+public:
+
+    CommunicatorObserverI() : _hostResolverObserver(ICE_MAKE_SHARED(HostResolverObserverI))
+    {
+    }
+
+    virtual Ice::Instrumentation::ObserverPtr
+    getConnectionEstablishmentObserver(const Ice::EndpointPtr&, const string&)
+    {
+        return ICE_NULLPTR;
+    }
+
+    virtual Ice::Instrumentation::ObserverPtr
+    getEndpointLookupObserver(const Ice::EndpointPtr&)
+    {
+        return ICE_NULLPTR;
+    }
+
+    virtual Ice::Instrumentation::ConnectionObserverPtr
+    getConnectionObserver(const Ice::ConnectionInfoPtr&,
+                          const Ice::EndpointPtr&,
+                          Ice::Instrumentation::ConnectionState,
+                          const Ice::Instrumentation::ConnectionObserverPtr&)
+    {
+        return ICE_NULLPTR;
+    }
+
+    virtual Ice::Instrumentation::ThreadObserverPtr
+    getThreadObserver(const string&,
+                      const string& id,
+                      Ice::Instrumentation::ThreadState,
+                      const Ice::Instrumentation::ThreadObserverPtr&)
+    {
+        if(id.find("Ice.HostResolver") == 0)
+        {
+            return _hostResolverObserver;
+        }
+        return ICE_NULLPTR;
+    }
+
+    virtual Ice::Instrumentation::InvocationObserverPtr
+    getInvocationObserver(const Ice::ObjectPrxPtr&, const string&, const Ice::Context&)
+    {
+        return ICE_NULLPTR;
+    }
+
+    virtual Ice::Instrumentation::DispatchObserverPtr
+    getDispatchObserver(const Ice::Current&, Ice::Int)
+    {
+        return ICE_NULLPTR;
+    }
+
+    virtual void
+    setObserverUpdater(const Ice::Instrumentation::ObserverUpdaterPtr&)
+    {
+    }
+
+    int
+    getLookupCount()
+    {
+        return _hostResolverObserver->getLookupCount();
+    }
+
+private:
+
+    const HostResolverObserverIPtr _hostResolverObserver;
+};
+ICE_DEFINE_PTR(CommunicatorObserverIPtr, CommunicatorObserverI);
+
 void
 deactivate(const RemoteCommunicatorPrxPtr& com, vector<RemoteObjectAdapterPrxPtr>& adapters)
 {
@@ -413,6 +535,85 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing connection prewarming... " << flush;
+    {
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("AdapterPrewarm1", "default"));
+        adapters.push_back(com->createObjectAdapter("AdapterPrewarm2", "default"));
+        adapters.push_back(com->createObjectAdapter("AdapterPrewarm3", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        vector<TestIntfPrxPtr> proxies;
+        Ice::EndpointSeq endpoints = test->ice_getEndpoints();
+        for(Ice::EndpointSeq::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+        {
+            proxies.push_back(ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpoints(Ice::EndpointSeq(1, *p))));
+        }
+
+        //
+        // Nothing is invoked on the proxies until the prewarmed connections
+        // are bound, the connections must be established by the prewarming.
+        //
+        test->ice_prewarmConnections();
+        for(vector<TestIntfPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+        {
+            (*p)->ice_prewarmConnections();
+        }
+
+        IceUtil::Time deadline = IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::seconds(30);
+        bool bound = false;
+        while(!bound)
+        {
+            test(IceUtil::Time::now(IceUtil::Time::Monotonic) < deadline);
+            bound = test->ice_getCachedConnection() != ICE_NULLPTR;
+            for(vector<TestIntfPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end() && bound; ++p)
+            {
+                bound = (*p)->ice_getCachedConnection() != ICE_NULLPTR;
+            }
+            if(!bound)
+            {
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+        }
+
+        set<Ice::ConnectionPtr> connections;
+        for(vector<TestIntfPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+        {
+            connections.insert((*p)->ice_getCachedConnection());
+        }
+        test(connections.size() == 3);
+
+        //
+        // The proxy with all the endpoints reuses one of the prewarmed connections.
+        //
+        test(connections.find(test->ice_getCachedConnection()) != connections.end());
+
+        set<string> names;
+        for(vector<TestIntfPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+        {
+            names.insert((*p)->getAdapterName());
+            test(connections.find((*p)->ice_getCachedConnection()) != connections.end());
+        }
+        test(names.size() == 3);
+
+        //
+        // Failures to establish a connection are ignored.
+        //
+        deactivate(com, adapters);
+        test->ice_prewarmConnections();
+        TestIntfPrxPtr refused = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_connectionId("refused"));
+        refused->ice_prewarmConnections();
+        try
+        {
+            refused->ice_ping();
+            test(false);
+        }
+        catch(const Ice::LocalException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
     cout << "testing random endpoint selection... " << flush;
     {
         vector<RemoteObjectAdapterPrxPtr> adapters;
@@ -1053,6 +1254,65 @@ allTests(const Ice::CommunicatorPtr& communicator)
         cout << "ok" << endl;
     }
 
+    {
+        cout << "testing host resolution... " << flush;
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.HostResolver.SizeMax", "2");
+        initData.properties->setProperty("Ice.HostResolver.CacheTimeout", "60");
+        CommunicatorObserverIPtr observer = ICE_MAKE_SHARED(CommunicatorObserverI);
+        initData.observer = observer;
+        Ice::CommunicatorHolder clientCommunicator(initData);
+
+        ostringstream str;
+        str << "communicator:" << getTestProtocol(communicator->getProperties()) << " -h localhost -p "
+            << getTestPort(communicator->getProperties(), 0);
+        Ice::ObjectPrxPtr prx = clientCommunicator->stringToProxy(str.str());
+
+        //
+        // Each connection ID requires a new connection. The concurrent
+        // connection establishments share a single DNS lookup and the
+        // next ones use the cached addresses.
+        //
+#ifdef ICE_CPP11_MAPPING
+        vector<future<void>> results;
+        for(int i = 0; i < 10; ++i)
+        {
+            ostringstream id;
+            id << "host-" << i;
+            results.push_back(prx->ice_connectionId(id.str())->ice_pingAsync());
+        }
+        for(vector<future<void>>::iterator p = results.begin(); p != results.end(); ++p)
+        {
+            p->get();
+        }
+#else
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < 10; ++i)
+        {
+            ostringstream id;
+            id << "host-" << i;
+            results.push_back(prx->ice_connectionId(id.str())->begin_ice_ping());
+        }
+        for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+        {
+            (*p)->getProxy()->end_ice_ping(*p);
+        }
+#endif
+        test(observer->getLookupCount() == 1);
+
+        for(int i = 10; i < 15; ++i)
+        {
+            ostringstream id;
+            id << "host-" << i;
+            prx->ice_connectionId(id.str())->ice_ping();
+        }
+        test(observer->getLookupCount() == 1);
+
+        cout << "ok" << endl;
+    }
+
     //
     // On Windows, the FD limit is very high and there's no way to limit the number of FDs
     // for the server so we don't run this test.
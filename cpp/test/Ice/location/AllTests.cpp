@@ -627,6 +627,106 @@ allTests(const Ice::CommunicatorPtr& communicator, const string& ref)
     }
     cout << "ok" << endl;
 
+    cout << "testing locator cache refresh and negative caching... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCacheRefreshThreshold", "25");
+        initData.properties->setProperty("Ice.LocatorCacheNotRegisteredTimeout", "1");
+        initData.properties->setProperty("Ice.RetryIntervals", "-1"); // Count a single lookup per invocation.
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        int count = locator->getRequestCount();
+        try
+        {
+            ic->stringToProxy("test@TestAdapter6")->ice_locatorCacheTimeout(0)->ice_ping(); // No locator cache.
+            test(false);
+        }
+        catch(const Ice::NotRegisteredException&)
+        {
+        }
+        test(++count == locator->getRequestCount());
+        try
+        {
+            ic->stringToProxy("test@TestAdapter6")->ice_ping(); // Fails from the locator cache.
+            test(false);
+        }
+        catch(const Ice::NotRegisteredException&)
+        {
+        }
+        test(count == locator->getRequestCount());
+
+        //
+        // The adapter keeps failing from the locator cache until the not
+        // registered timeout expires, it's then looked up again.
+        //
+        registry->setAdapterDirectProxy("TestAdapter6", locator->findAdapterById("TestAdapter"));
+        ++count;
+        IceUtil::Time deadline = IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::seconds(30);
+        while(true)
+        {
+            try
+            {
+                ic->stringToProxy("test@TestAdapter6")->ice_locatorCacheTimeout(60)->ice_ping();
+                break;
+            }
+            catch(const Ice::NotRegisteredException&)
+            {
+                test(count == locator->getRequestCount());
+                test(IceUtil::Time::now(IceUtil::Time::Monotonic) < deadline);
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+        }
+        test(++count == locator->getRequestCount());
+        ic->stringToProxy("test@TestAdapter6")->ice_locatorCacheTimeout(60)->ice_ping();
+        test(count == locator->getRequestCount());
+
+        //
+        // Past a quarter of the 4s timeout, the cached endpoints are used
+        // and refreshed in the background.
+        //
+        ++count;
+        while(locator->getRequestCount() < count)
+        {
+            test(IceUtil::Time::now(IceUtil::Time::Monotonic) < deadline);
+            ic->stringToProxy("test@TestAdapter6")->ice_locatorCacheTimeout(4)->ice_ping();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(count == locator->getRequestCount());
+        ic->stringToProxy("test@TestAdapter6")->ice_locatorCacheTimeout(60)->ice_ping();
+        test(count == locator->getRequestCount());
+        registry->setAdapterDirectProxy("TestAdapter6", 0);
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing locator cache persistence... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCacheFile", "locator.cache");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        int count = locator->getRequestCount();
+        ic->stringToProxy("test@TestAdapter")->ice_ping();
+        ic->stringToProxy("test")->ice_ping();
+        test(count < locator->getRequestCount());
+        count = locator->getRequestCount();
+        ic->destroy();
+
+        //
+        // The cache is saved when the communicator is destroyed and
+        // loaded by the next communicator.
+        //
+        ic = Ice::initialize(initData);
+        ic->stringToProxy("test@TestAdapter")->ice_ping();
+        ic->stringToProxy("test")->ice_ping();
+        test(count == locator->getRequestCount());
+        ic->destroy();
+        remove("locator.cache");
+    }
+    cout << "ok" << endl;
+
     cout << "testing proxy from server after shutdown... " << flush;
     hello = obj->getReplicatedHello();
     obj->shutdown();
@@ -57,5 +57,18 @@ allTests(const Ice::CommunicatorPtr& communicator)
     batchOnewaysAMI(derived);
     cout << "ok" << endl;
 
+    if(cl->ice_getConnection())
+    {
+        cout << "testing twoway operations with busy polling... " << flush;
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ThreadPool.Client.BusyPoll", "200");
+        Ice::CommunicatorHolder ich(initData);
+        Test::MyClassPrxPtr p = ICE_UNCHECKED_CAST(Test::MyClassPrx, ich->stringToProxy(ref));
+        twoways(ich.communicator(), p);
+        twowaysAMI(ich.communicator(), p);
+        cout << "ok" << endl;
+    }
+
     return cl;
 }
@@ -10,11 +10,58 @@
 #include <Ice/Ice.h>
 #include <Ice/Locator.h>
 #include <Ice/Router.h>
+#include <IceUtil/Random.h>
 #include <TestCommon.h>
 #include <Test.h>
 
 using namespace std;
 
+namespace
+{
+
+class EchoI : public Ice::Blobject
+{
+public:
+
+    virtual bool ice_invoke(ICE_IN(vector<Ice::Byte>) inEncaps, vector<Ice::Byte>& outEncaps, const Ice::Current&)
+    {
+        outEncaps = inEncaps;
+        return true;
+    }
+};
+
+int
+getPort(const Ice::ObjectAdapterPtr& adapter)
+{
+    for(Ice::EndpointInfoPtr info = adapter->getEndpoints()[0]->getInfo(); info; info = info->underlying)
+    {
+        Ice::IPEndpointInfoPtr ipInfo = ICE_DYNAMIC_CAST(Ice::IPEndpointInfo, info);
+        if(ipInfo)
+        {
+            return ipInfo->port;
+        }
+    }
+    test(false);
+    return 0;
+}
+
+void
+testEcho(const Ice::ObjectPrxPtr& echo, const vector<Ice::Byte>& data)
+{
+    Ice::OutputStream out(echo->ice_getCommunicator());
+    out.startEncapsulation();
+    out.write(data);
+    out.endEncapsulation();
+    vector<Ice::Byte> inEncaps;
+    out.finished(inEncaps);
+
+    vector<Ice::Byte> outEncaps;
+    test(echo->ice_invoke("echo", Ice::ICE_ENUM(OperationMode, Normal), inEncaps, outEncaps));
+    test(outEncaps == inEncaps);
+}
+
+}
+
 Test::MyClassPrxPtr
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -1104,6 +1151,21 @@ allTests(const Ice::CommunicatorPtr& communicator)
 #endif
     cout << "ok" << endl;
 
+    cout << "testing connection of derived proxies... " << flush;
+    {
+        //
+        // Proxies derived with a different facet, context or identity
+        // use the connection of the proxy they are derived from.
+        //
+        cl->ice_ping();
+        Ice::ConnectionPtr con = cl->ice_getCachedConnection();
+        test(cl->ice_facet("facet")->ice_getCachedConnection() == con);
+        test(cl->ice_context(c)->ice_getCachedConnection() == con);
+        test(cl->ice_identity(Ice::stringToIdentity("other"))->ice_getCachedConnection() == con);
+        test(!cl->ice_oneway()->ice_getCachedConnection());
+    }
+    cout << "ok" << endl;
+
     cout << "testing encoding versioning... " << flush;
     string ref20 = "test -e 2.0:" + endp;
     Test::MyClassPrxPtr cl20 = ICE_UNCHECKED_CAST(Test::MyClassPrx, communicator->stringToProxy(ref20));
@@ -1393,5 +1455,142 @@ allTests(const Ice::CommunicatorPtr& communicator)
 
     cout << "ok" << endl;
 
+    //
+    // permessage-deflate is only supported if Ice is built with it.
+    //
+    bool deflate = true;
+    try
+    {
+        communicator->stringToProxy("test:ws -h 127.0.0.1 -p 12010 --deflate");
+    }
+    catch(const Ice::FeatureNotSupportedException&)
+    {
+        deflate = false;
+    }
+
+    cout << "testing WebSocket permessage-deflate endpoint options... " << flush;
+    if(deflate)
+    {
+        Ice::ObjectPrxPtr p = communicator->stringToProxy("test:ws -h 127.0.0.1 -p 12010 --deflateWindowBits 10");
+        string pstr = communicator->proxyToString(p);
+        test(pstr.find("--deflate --deflateWindowBits 10") != string::npos);
+        test(pstr != communicator->proxyToString(communicator->stringToProxy("test:ws -h 127.0.0.1 -p 12010")));
+
+        p = communicator->stringToProxy(pstr);
+        test(communicator->proxyToString(p) == pstr);
+
+        try
+        {
+            // zlib doesn't support 8 bits windows
+            communicator->stringToProxy("test:ws -h 127.0.0.1 -p 12010 --deflateWindowBits 8");
+            test(false);
+        }
+        catch(const Ice::EndpointParseException&)
+        {
+        }
+
+        try
+        {
+            // Missing window bits
+            communicator->stringToProxy("test:ws -h 127.0.0.1 -p 12010 --deflateWindowBits");
+            test(false);
+        }
+        catch(const Ice::EndpointParseException&)
+        {
+        }
+
+        try
+        {
+            // Unexpected argument
+            communicator->stringToProxy("test:ws -h 127.0.0.1 -p 12010 --deflate yes");
+            test(false);
+        }
+        catch(const Ice::EndpointParseException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    if(deflate)
+    {
+        cout << "testing WebSocket permessage-deflate round trips... " << flush;
+
+        //
+        // The messages are much larger than the transceiver buffers, a compressed
+        // message is read in several chunks.
+        //
+        vector<Ice::Byte> compressible(512 * 1024);
+        for(size_t i = 0; i < compressible.size(); ++i)
+        {
+            compressible[i] = static_cast<Ice::Byte>(i % 64);
+        }
+        vector<Ice::Byte> random(128 * 1024);
+        IceUtilInternal::generateRandom(reinterpret_cast<char*>(&random[0]), random.size());
+
+        vector<string> protocols;
+        protocols.push_back("ws");
+        const string protocol = getTestProtocol(communicator->getProperties());
+        if(protocol == "ssl" || protocol == "wss")
+        {
+            protocols.push_back("wss");
+        }
+
+        //
+        // The server either declines the offer or accepts it, with or without
+        // context takeover. The client offers it with or without context takeover.
+        //
+        const string serverOptions[] = { "", " --deflate", " --deflate --deflateNoContextTakeover" };
+        const string clientOptions[] = { " --deflate", " --deflate --deflateNoContextTakeover",
+                                         " --deflate --deflateWindowBits 9" };
+        for(vector<string>::const_iterator p = protocols.begin(); p != protocols.end(); ++p)
+        {
+            for(size_t i = 0; i < sizeof(serverOptions) / sizeof(string); ++i)
+            {
+                Ice::ObjectAdapterPtr adapter =
+                    communicator->createObjectAdapterWithEndpoints("DeflateAdapter",
+                                                                   *p + " -h 127.0.0.1" + serverOptions[i]);
+                adapter->add(ICE_MAKE_SHARED(EchoI), Ice::stringToIdentity("echo"));
+                adapter->activate();
+
+                for(size_t j = 0; j < sizeof(clientOptions) / sizeof(string); ++j)
+                {
+                    ostringstream os;
+                    os << "echo:" << *p << " -h 127.0.0.1 -p " << getPort(adapter) << clientOptions[j];
+                    Ice::ObjectPrxPtr echo = communicator->stringToProxy(os.str())->ice_collocationOptimized(false);
+
+                    Ice::WSConnectionInfoPtr info =
+                        ICE_DYNAMIC_CAST(Ice::WSConnectionInfo, echo->ice_getConnection()->getInfo());
+                    test(info);
+                    map<string, string>::const_iterator q = info->headers.find("Sec-WebSocket-Extensions");
+                    if(serverOptions[i].empty())
+                    {
+                        test(q == info->headers.end());
+                    }
+                    else
+                    {
+                        test(q != info->headers.end() && q->second.find("permessage-deflate") == 0);
+                        test((q->second.find("server_no_context_takeover") != string::npos) ==
+                             (serverOptions[i].find("NoContextTakeover") != string::npos));
+                        test((q->second.find("client_no_context_takeover") != string::npos) ==
+                             (clientOptions[j].find("NoContextTakeover") != string::npos));
+                    }
+
+                    //
+                    // Send several messages, with context takeover the compression
+                    // context of a message depends on the previous messages.
+                    //
+                    for(int k = 0; k < 3; ++k)
+                    {
+                        testEcho(echo, compressible);
+                        testEcho(echo, random);
+                    }
+                }
+
+                adapter->destroy();
+            }
+        }
+        cout << "ok" << endl;
+    }
+
     return cl;
 }
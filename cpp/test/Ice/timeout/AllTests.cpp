@@ -477,6 +477,47 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing connection pool... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Default.ConnectionPoolSize", "2");
+        Ice::CommunicatorHolder ich(initData);
+        TimeoutPrxPtr to = ICE_UNCHECKED_CAST(TimeoutPrx, ich->stringToProxy(sref));
+        to->op();
+        Ice::ConnectionPtr connection = to->ice_getConnection();
+
+        //
+        // The request is sent over the single connection of the pool and
+        // triggers the establishment of a second connection. Once it's
+        // established, it's preferred over the busy connection.
+        //
+#ifdef ICE_CPP11_MAPPING
+        auto f = to->sleepAsync(1000);
+#else
+        Ice::AsyncResultPtr r = to->begin_sleep(1000);
+#endif
+        Ice::ConnectionPtr other;
+        for(int i = 0; i < 80; ++i)
+        {
+            other = ich->stringToProxy(sref)->ice_getConnection();
+            if(other != connection)
+            {
+                break;
+            }
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(other != connection);
+        test(to->ice_getConnection() == other);
+        to->op();
+#ifdef ICE_CPP11_MAPPING
+        f.get();
+#else
+        to->end_sleep(r);
+#endif
+    }
+    cout << "ok" << endl;
+
     cout << "testing invocation timeouts with collocated calls... " << flush;
     {
         communicator->getProperties()->setProperty("TimeoutCollocated.AdapterId", "timeoutAdapter");
@@ -328,6 +328,80 @@ allTests(const Ice::CommunicatorPtr& comm)
     }
     cout << "ok" << endl;
 
+    cout << "testing replication with dispatch load balancing... " << flush;
+    {
+        map<string, string> params;
+        params["replicaGroup"] = "Dispatch";
+        params["id"] = "Server1";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server2";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server3";
+        instantiateServer(admin, "Server", "localnode", params);
+        TestIntfPrx obj = TestIntfPrx::uncheckedCast(comm->stringToProxy("Dispatch"));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_locatorCacheTimeout(0));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_connectionCached(false));
+        set<string> replicaIds = serverReplicaIds;
+        while(!replicaIds.empty())
+        {
+            try
+            {
+                replicaIds.erase(obj->getReplicaId());
+            }
+            catch(const Ice::LocalException& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+        }
+
+        //
+        // Wait for the node to report the dispatch load of the servers
+        // and make sure the replicas are still all used.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1500));
+        replicaIds = serverReplicaIds;
+        while(!replicaIds.empty())
+        {
+            try
+            {
+                replicaIds.erase(obj->getReplicaId());
+            }
+            catch(const Ice::LocalException& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+        }
+
+        //
+        // Load Server1 with slow dispatches, once the node reported its
+        // load, the registry never returns it: it's always compared with
+        // a less loaded replica.
+        //
+        TestIntfPrx server1 = TestIntfPrx::uncheckedCast(comm->stringToProxy("Dispatch@Server1.ReplicatedAdapter"));
+        server1->sleep(200);
+        Ice::AsyncResultPtr r = server1->begin_sleep(1000);
+        IceUtil::Time deadline = IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::seconds(30);
+        int picks = 0;
+        while(picks < 30)
+        {
+            test(IceUtil::Time::now(IceUtil::Time::Monotonic) < deadline);
+            if(r->isCompleted())
+            {
+                server1->end_sleep(r);
+                r = server1->begin_sleep(1000);
+            }
+            picks = obj->getReplicaId() == "Server1.ReplicatedAdapter" ? 0 : picks + 1;
+        }
+        server1->end_sleep(r);
+
+        removeServer(admin, "Server1");
+        removeServer(admin, "Server2");
+        removeServer(admin, "Server3");
+    }
+    cout << "ok" << endl;
+
     cout << "testing replication with random load balancing... " << flush;
     {
         map<string, string> params;
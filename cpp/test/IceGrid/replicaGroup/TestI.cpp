@@ -27,3 +27,9 @@ TestI::getReplicaIdAndShutdown(const Ice::Current& current)
     current.adapter->getCommunicator()->shutdown();
     return _properties->getProperty(current.adapter->getName() + ".AdapterId");
 }
+
+void
+TestI::sleep(Ice::Int ms, const Ice::Current&)
+{
+    IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(ms));
+}
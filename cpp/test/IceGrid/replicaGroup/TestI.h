@@ -20,6 +20,7 @@ public:
 
     virtual std::string getReplicaId(const Ice::Current&);
     virtual std::string getReplicaIdAndShutdown(const Ice::Current&);
+    virtual void sleep(Ice::Int, const Ice::Current&);
 
 private:
 
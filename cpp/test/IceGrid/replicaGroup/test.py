@@ -13,12 +13,17 @@ registryProps = {
     "IceGrid.Registry.DynamicRegistration" : 1
 }
 
+nodeProps = {
+    "IceGrid.Node.DispatchLoadPeriod" : 1
+}
+
 clientProps = {
     "Ice.RetryIntervals" : "0 50 100 250"
 }
 
 TestSuite(__file__,
           [IceGridTestCase(icegridregistry=[IceGridRegistryMaster(props=registryProps)],
+                           icegridnode=IceGridNode(props=nodeProps),
                            client=IceGridClient(props=clientProps))],
           libDirs=["registryplugin", "testservice"],
           multihost=False)
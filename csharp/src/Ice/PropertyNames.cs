@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue May 16 17:04:55 2017
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Mon Oct 19 07:21:20 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -34,6 +34,7 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ACM\.Heartbeat$", false, null),
              new Property(@"^Ice\.Admin\.ACM\.Close$", false, null),
              new Property(@"^Ice\.Admin\.ACM$", false, null),
+             new Property(@"^Ice\.Admin\.Acceptors$", false, null),
              new Property(@"^Ice\.Admin\.AdapterId$", false, null),
              new Property(@"^Ice\.Admin\.Endpoints$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.EndpointSelection$", false, null),
@@ -66,6 +67,7 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^Ice\.Admin\.MessageSizeMax$", false, null),
              new Property(@"^Ice\.Admin\.DelayCreation$", false, null),
              new Property(@"^Ice\.Admin\.Enabled$", false, null),
@@ -86,6 +88,7 @@ namespace IceInternal
              new Property(@"^Ice\.Config$", false, null),
              new Property(@"^Ice\.ConsoleListener$", false, null),
              new Property(@"^Ice\.Default\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Default\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Default\.EncodingVersion$", false, null),
              new Property(@"^Ice\.Default\.EndpointSelection$", false, null),
              new Property(@"^Ice\.Default\.Host$", false, null),
@@ -121,10 +124,15 @@ namespace IceInternal
              new Property(@"^Ice\.FactoryAssemblies$", false, null),
              new Property(@"^Ice\.HTTPProxyHost$", false, null),
              new Property(@"^Ice\.HTTPProxyPort$", false, null),
+             new Property(@"^Ice\.HostResolver\.CacheTimeout$", false, null),
+             new Property(@"^Ice\.HostResolver\.SizeMax$", false, null),
              new Property(@"^Ice\.ImplicitContext$", false, null),
              new Property(@"^Ice\.InitPlugins$", false, null),
              new Property(@"^Ice\.IPv4$", false, null),
              new Property(@"^Ice\.IPv6$", false, null),
+             new Property(@"^Ice\.LocatorCacheFile$", false, null),
+             new Property(@"^Ice\.LocatorCacheNotRegisteredTimeout$", false, null),
+             new Property(@"^Ice\.LocatorCacheRefreshThreshold$", false, null),
              new Property(@"^Ice\.LogFile$", false, null),
              new Property(@"^Ice\.LogFile\.SizeMax$", false, null),
              new Property(@"^Ice\.LogStdErr\.Convert$", false, null),
@@ -159,6 +167,7 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Client\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.BusyPoll$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeMax$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeWarn$", false, null),
@@ -166,6 +175,7 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Server\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.BusyPoll$", false, null),
              new Property(@"^Ice\.ThreadPriority$", false, null),
              new Property(@"^Ice\.ToStringMode$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Properties$", false, null),
@@ -176,9 +186,12 @@ namespace IceInternal
              new Property(@"^Ice\.Trace\.Retry$", false, null),
              new Property(@"^Ice\.Trace\.Slicing$", false, null),
              new Property(@"^Ice\.Trace\.ThreadPool$", false, null),
+             new Property(@"^Ice\.UDP\.RcvBatchSize$", false, null),
              new Property(@"^Ice\.UDP\.RcvSize$", false, null),
+             new Property(@"^Ice\.UDP\.SndBatchSize$", false, null),
              new Property(@"^Ice\.UDP\.SndSize$", false, null),
              new Property(@"^Ice\.TCP\.Backlog$", false, null),
+             new Property(@"^Ice\.TCP\.FastOpen$", false, null),
              new Property(@"^Ice\.TCP\.RcvSize$", false, null),
              new Property(@"^Ice\.TCP\.SndSize$", false, null),
              new Property(@"^Ice\.UseApplicationClassLoader$", false, null),
@@ -213,6 +226,7 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ACM\.Close$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ACM$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Acceptors$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.AdapterId$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Endpoints$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.EndpointSelection$", false, null),
@@ -245,11 +259,13 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.MessageSizeMax$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Close$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Acceptors$", false, null),
              new Property(@"^IceDiscovery\.Reply\.AdapterId$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Endpoints$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.EndpointSelection$", false, null),
@@ -282,11 +298,13 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceDiscovery\.Reply\.MessageSizeMax$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Close$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Acceptors$", false, null),
              new Property(@"^IceDiscovery\.Locator\.AdapterId$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Endpoints$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.EndpointSelection$", false, null),
@@ -319,6 +337,7 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceDiscovery\.Locator\.MessageSizeMax$", false, null),
              new Property(@"^IceDiscovery\.Lookup$", false, null),
              new Property(@"^IceDiscovery\.Timeout$", false, null),
@@ -337,6 +356,7 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ACM\.Close$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ACM$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Acceptors$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.AdapterId$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Endpoints$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.EndpointSelection$", false, null),
@@ -369,11 +389,13 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.MessageSizeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Close$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Acceptors$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.AdapterId$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Endpoints$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.EndpointSelection$", false, null),
@@ -406,6 +428,7 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.MessageSizeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Lookup$", false, null),
              new Property(@"^IceLocatorDiscovery\.Timeout$", false, null),
@@ -461,6 +484,7 @@ namespace IceInternal
              new Property(@"^IceBridge\.Source\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceBridge\.Source\.ACM\.Close$", false, null),
              new Property(@"^IceBridge\.Source\.ACM$", false, null),
+             new Property(@"^IceBridge\.Source\.Acceptors$", false, null),
              new Property(@"^IceBridge\.Source\.AdapterId$", false, null),
              new Property(@"^IceBridge\.Source\.Endpoints$", false, null),
              new Property(@"^IceBridge\.Source\.Locator\.EndpointSelection$", false, null),
@@ -493,6 +517,7 @@ namespace IceInternal
              new Property(@"^IceBridge\.Source\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceBridge\.Source\.MessageSizeMax$", false, null),
              new Property(@"^IceBridge\.Target\.Endpoints$", false, null),
              new Property(@"^IceBridge\.InstanceName$", false, null),
@@ -516,6 +541,7 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ACM\.Close$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ACM$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Acceptors$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.AdapterId$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Endpoints$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.EndpointSelection$", false, null),
@@ -548,11 +574,13 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.MessageSizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Close$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Acceptors$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.AdapterId$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Endpoints$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.EndpointSelection$", false, null),
@@ -585,6 +613,7 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.MessageSizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.Observers$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.SaveToRegistry$", false, null),
@@ -597,6 +626,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ACM$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Acceptors$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.AdapterId$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Endpoints$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.EndpointSelection$", false, null),
@@ -629,12 +659,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.InstanceName$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Node\.ACM$", false, null),
+             new Property(@"^IceGrid\.Node\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Node\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Node\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.EndpointSelection$", false, null),
@@ -667,12 +699,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGrid\.Node\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Node\.AllowRunningServersAsRoot$", false, null),
              new Property(@"^IceGrid\.Node\.AllowEndpointsOverride$", false, null),
              new Property(@"^IceGrid\.Node\.CollocateRegistry$", false, null),
              new Property(@"^IceGrid\.Node\.Data$", false, null),
              new Property(@"^IceGrid\.Node\.DisableOnFailure$", false, null),
+             new Property(@"^IceGrid\.Node\.DispatchLoadPeriod$", false, null),
              new Property(@"^IceGrid\.Node\.Name$", false, null),
              new Property(@"^IceGrid\.Node\.Output$", false, null),
              new Property(@"^IceGrid\.Node\.ProcessorSocketCount$", false, null),
@@ -713,6 +747,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.EndpointSelection$", false, null),
@@ -745,6 +780,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionCached$", false, null),
@@ -760,6 +796,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.EndpointSelection$", false, null),
@@ -792,6 +829,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.CryptPasswords$", false, null),
              new Property(@"^IceGrid\.Registry\.DefaultTemplates$", false, null),
@@ -799,6 +837,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.EndpointSelection$", false, null),
@@ -831,6 +870,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Enabled$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Address$", false, null),
@@ -841,6 +881,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.EndpointSelection$", false, null),
@@ -873,7 +914,9 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.LMDB\.GroupCommitMaxLatency$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.MapSize$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.Path$", false, null),
              new Property(@"^IceGrid\.Registry\.NodeSessionTimeout$", false, null),
@@ -889,12 +932,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier$", false, null),
              new Property(@"^IceGrid\.Registry\.ReplicaName$", false, null),
              new Property(@"^IceGrid\.Registry\.ReplicaSessionTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.ReplicationLogSize$", false, null),
              new Property(@"^IceGrid\.Registry\.RequireNodeCertCN$", false, null),
              new Property(@"^IceGrid\.Registry\.RequireReplicaCertCN$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.EndpointSelection$", false, null),
@@ -927,12 +972,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionFilters$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Acceptors$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.AdapterId$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.EndpointSelection$", false, null),
@@ -965,6 +1012,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.EndpointSelection$", false, null),
@@ -1000,6 +1048,7 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ACM\.Heartbeat$", false, null),
              new Property(@"^IcePatch2\.ACM\.Close$", false, null),
              new Property(@"^IcePatch2\.ACM$", false, null),
+             new Property(@"^IcePatch2\.Acceptors$", false, null),
              new Property(@"^IcePatch2\.AdapterId$", false, null),
              new Property(@"^IcePatch2\.Endpoints$", false, null),
              new Property(@"^IcePatch2\.Locator\.EndpointSelection$", false, null),
@@ -1032,6 +1081,7 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^IcePatch2\.MessageSizeMax$", false, null),
              new Property(@"^IcePatch2\.Directory$", false, null),
              new Property(@"^IcePatch2\.InstanceName$", false, null),
@@ -1068,6 +1118,7 @@ namespace IceInternal
              new Property(@"^IceSSL\.FindCert$", false, null),
              new Property(@"^IceSSL\.FindCert\.[^\s]+$", true, null),
              new Property(@"^IceSSL\.InitOpenSSL$", false, null),
+             new Property(@"^IceSSL\.KernelTLS$", false, null),
              new Property(@"^IceSSL\.KeyFile$", true, null),
              new Property(@"^IceSSL\.Keychain$", false, null),
              new Property(@"^IceSSL\.KeychainPassword$", false, null),
@@ -1118,6 +1169,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ACM\.Heartbeat$", false, null),
              new Property(@"^Glacier2\.Client\.ACM\.Close$", false, null),
              new Property(@"^Glacier2\.Client\.ACM$", false, null),
+             new Property(@"^Glacier2\.Client\.Acceptors$", false, null),
              new Property(@"^Glacier2\.Client\.AdapterId$", false, null),
              new Property(@"^Glacier2\.Client\.Endpoints$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.EndpointSelection$", false, null),
@@ -1150,6 +1202,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^Glacier2\.Client\.MessageSizeMax$", false, null),
              new Property(@"^Glacier2\.Client\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Client\.Buffered$", false, null),
@@ -1193,6 +1246,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ACM\.Heartbeat$", false, null),
              new Property(@"^Glacier2\.Server\.ACM\.Close$", false, null),
              new Property(@"^Glacier2\.Server\.ACM$", false, null),
+             new Property(@"^Glacier2\.Server\.Acceptors$", false, null),
              new Property(@"^Glacier2\.Server\.AdapterId$", false, null),
              new Property(@"^Glacier2\.Server\.Endpoints$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.EndpointSelection$", false, null),
@@ -1225,6 +1279,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.BusyPoll$", false, null),
              new Property(@"^Glacier2\.Server\.MessageSizeMax$", false, null),
              new Property(@"^Glacier2\.Server\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Server\.Buffered$", false, null),
@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue May 16 17:04:55 2017
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Mon Oct 19 07:21:20 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -35,6 +35,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ACM\.Heartbeat/", false, null),
     new Property("/^Ice\.Admin\.ACM\.Close/", false, null),
     new Property("/^Ice\.Admin\.ACM/", false, null),
+    new Property("/^Ice\.Admin\.Acceptors/", false, null),
     new Property("/^Ice\.Admin\.AdapterId/", false, null),
     new Property("/^Ice\.Admin\.Endpoints/", false, null),
     new Property("/^Ice\.Admin\.Locator\.EndpointSelection/", false, null),
@@ -67,6 +68,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ThreadPool\.Serialize/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadPriority/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.BusyPoll/", false, null),
     new Property("/^Ice\.Admin\.MessageSizeMax/", false, null),
     new Property("/^Ice\.Admin\.DelayCreation/", false, null),
     new Property("/^Ice\.Admin\.Enabled/", false, null),
@@ -87,6 +89,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Config/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
+    new Property("/^Ice\.Default\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
     new Property("/^Ice\.Default\.EndpointSelection/", false, null),
     new Property("/^Ice\.Default\.Host/", false, null),
@@ -122,10 +125,15 @@ PropertyNames.IceProps =
     new Property("/^Ice\.FactoryAssemblies/", false, null),
     new Property("/^Ice\.HTTPProxyHost/", false, null),
     new Property("/^Ice\.HTTPProxyPort/", false, null),
+    new Property("/^Ice\.HostResolver\.CacheTimeout/", false, null),
+    new Property("/^Ice\.HostResolver\.SizeMax/", false, null),
     new Property("/^Ice\.ImplicitContext/", false, null),
     new Property("/^Ice\.InitPlugins/", false, null),
     new Property("/^Ice\.IPv4/", false, null),
     new Property("/^Ice\.IPv6/", false, null),
+    new Property("/^Ice\.LocatorCacheFile/", false, null),
+    new Property("/^Ice\.LocatorCacheNotRegisteredTimeout/", false, null),
+    new Property("/^Ice\.LocatorCacheRefreshThreshold/", false, null),
     new Property("/^Ice\.LogFile/", false, null),
     new Property("/^Ice\.LogFile\.SizeMax/", false, null),
     new Property("/^Ice\.LogStdErr\.Convert/", false, null),
@@ -160,6 +168,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Client\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.BusyPoll/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeWarn/", false, null),
@@ -167,6 +176,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Server\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.BusyPoll/", false, null),
     new Property("/^Ice\.ThreadPriority/", false, null),
     new Property("/^Ice\.ToStringMode/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Properties/", false, null),
@@ -177,9 +187,12 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Trace\.Retry/", false, null),
     new Property("/^Ice\.Trace\.Slicing/", false, null),
     new Property("/^Ice\.Trace\.ThreadPool/", false, null),
+    new Property("/^Ice\.UDP\.RcvBatchSize/", false, null),
     new Property("/^Ice\.UDP\.RcvSize/", false, null),
+    new Property("/^Ice\.UDP\.SndBatchSize/", false, null),
     new Property("/^Ice\.UDP\.SndSize/", false, null),
     new Property("/^Ice\.TCP\.Backlog/", false, null),
+    new Property("/^Ice\.TCP\.FastOpen/", false, null),
     new Property("/^Ice\.TCP\.RcvSize/", false, null),
     new Property("/^Ice\.TCP\.SndSize/", false, null),
     new Property("/^Ice\.UseApplicationClassLoader/", false, null),
@@ -148,6 +148,7 @@ class Darwin(Platform):
         if config.buildPlatform in ["iphoneos", "iphonesimulator", "macosx"] and "xcodesdk" in config.buildConfig:
             return (["Ice/.*", "IceSSL/configuration"],
                     ["Ice/background",
+                     "Ice/benchmark",
                      "Ice/echo",
                      "Ice/faultTolerance",
                      "Ice/gc",
@@ -246,6 +247,7 @@ class Windows(Platform):
         if config.uwp:
             return (["cpp/Ice/.*", "cpp/IceSSL/configuration"],
                     ["Ice/background",
+                     "Ice/benchmark",
                      "Ice/echo",
                      "Ice/faultTolerance",
                      "Ice/gc",
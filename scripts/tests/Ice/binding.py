@@ -17,4 +17,21 @@ def setlimits():
         import resource
         resource.setrlimit(resource.RLIMIT_NOFILE, (92, 92))
 
-TestSuite(__name__, [ClientServerTestCase(server=Server(preexec_fn=setlimits))])
+class IceBindingTestSuite(TestSuite):
+
+    def setup(self, current):
+        TestSuite.setup(self, current)
+
+        self.testcases = {} # Clear default test cases
+        self.addTestCase(ClientServerTestCase(server=Server(preexec_fn=setlimits)))
+
+        #
+        # With C++, also run the test with TCP Fast Open enabled.
+        #
+        if isinstance(self.getMapping(), CppMapping):
+            props = { "Ice.TCP.FastOpen" : 1 }
+            self.addTestCase(ClientServerTestCase("client/server with TCP Fast Open",
+                                                  client=Client(props=props),
+                                                  servers=[Server(preexec_fn=setlimits, props=props)]))
+
+IceBindingTestSuite(__name__)
@@ -30,4 +30,14 @@ class IceUdpTestSuite(TestSuite):
         self.addTestCase(ClientServerTestCase(client=Client(args=[n]),
                                               servers=[Server(args=[i], ready="McastTestAdapter") for i in servers]))
 
+        #
+        # With C++, also run the test with datagrams received and sent in batches.
+        #
+        if isinstance(self.getMapping(), CppMapping):
+            props = { "Ice.UDP.RcvBatchSize" : 16, "Ice.UDP.SndBatchSize" : 16 }
+            self.addTestCase(ClientServerTestCase("client/server with batched datagrams",
+                                                  client=Client(args=[n], props=props),
+                                                  servers=[Server(args=[i], ready="McastTestAdapter", props=props)
+                                                           for i in servers]))
+
 IceUdpTestSuite(__name__, multihost=False, options=options)